@@ -0,0 +1,557 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <algorithm>
+#include <utility>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_art {
+
+// ============================================================================
+// ADAPTIVE RADIX TREE - Ordered string map (Leis et al., "The Adaptive Radix
+// Tree", ICDE 2013)
+// Each level consumes one key byte, so a lookup costs O(key length) byte
+// steps instead of O(log n) full-string compares. Inner nodes grow through
+// Node4 -> Node16 -> Node48 -> Node256 as children are added, and runs of
+// single-child levels are collapsed into a stored prefix (path compression).
+// Leaves keep only the key suffix below their parent; full keys are rebuilt
+// during iteration. A key that ends inside the tree (a prefix of another key)
+// is stored in its node's terminal slot, which sorts before all children.
+// ============================================================================
+template<typename T>
+class art_map {
+private:
+    enum class Kind : std::uint8_t { leaf, node4, node16, node48, node256 };
+
+    struct Node {
+        Kind kind;
+        explicit Node(Kind k) : kind(k) {}
+    };
+
+    struct Leaf : Node {
+        std::string suffix;
+        T value;
+        Leaf(std::string_view s, const T& v) : Node(Kind::leaf), suffix(s), value(v) {}
+    };
+
+    struct Inner : Node {
+        std::uint16_t count = 0;
+        std::string prefix;
+        Leaf* terminal = nullptr;
+        explicit Inner(Kind k) : Node(k) {}
+    };
+
+    struct Node4 : Inner {
+        std::uint8_t keys[4];
+        Node* children[4];
+        Node4() : Inner(Kind::node4) {}
+    };
+
+    struct Node16 : Inner {
+        std::uint8_t keys[16];
+        Node* children[16];
+        Node16() : Inner(Kind::node16) {}
+    };
+
+    struct Node48 : Inner {
+        std::uint8_t index[256] = {};  // 0 = empty, otherwise slot + 1
+        Node* children[48];
+        Node48() : Inner(Kind::node48) {}
+    };
+
+    struct Node256 : Inner {
+        Node* children[256] = {};
+        Node256() : Inner(Kind::node256) {}
+    };
+
+    Node* root = nullptr;
+    std::size_t element_count = 0;
+
+    static Inner* as_inner(Node* n) { return static_cast<Inner*>(n); }
+    static Leaf* as_leaf(Node* n) { return static_cast<Leaf*>(n); }
+
+    static Node** find_child(Inner* in, std::uint8_t byte) {
+        switch (in->kind) {
+        case Kind::node4: {
+            auto* n = static_cast<Node4*>(in);
+            for (std::size_t i = 0; i < n->count; ++i)
+                if (n->keys[i] == byte) return &n->children[i];
+            return nullptr;
+        }
+        case Kind::node16: {
+            auto* n = static_cast<Node16*>(in);
+#if defined(__SSE2__)
+            // Compare all 16 key bytes at once
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp)) & ((1u << n->count) - 1);
+            return mask ? &n->children[std::countr_zero(mask)] : nullptr;
+#else
+            for (std::size_t i = 0; i < n->count; ++i)
+                if (n->keys[i] == byte) return &n->children[i];
+            return nullptr;
+#endif
+        }
+        case Kind::node48: {
+            auto* n = static_cast<Node48*>(in);
+            return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+        }
+        case Kind::node256: {
+            auto* n = static_cast<Node256*>(in);
+            return n->children[byte] ? &n->children[byte] : nullptr;
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+    // Moves the shared header into a larger node type
+    template<typename To, typename From>
+    static To* grow_header(From* from) {
+        To* to = new To();
+        to->count = from->count;
+        to->prefix = std::move(from->prefix);
+        to->terminal = from->terminal;
+        return to;
+    }
+
+    template<typename N>
+    static void insert_sorted(N* n, std::uint8_t byte, Node* child) {
+        std::size_t pos = 0;
+        while (pos < n->count && n->keys[pos] < byte) ++pos;
+        std::memmove(n->keys + pos + 1, n->keys + pos, n->count - pos);
+        std::memmove(n->children + pos + 1, n->children + pos, (n->count - pos) * sizeof(Node*));
+        n->keys[pos] = byte;
+        n->children[pos] = child;
+        ++n->count;
+    }
+
+    // Adds a child under byte, replacing ref with a bigger node when full
+    static void add_child(Node*& ref, std::uint8_t byte, Node* child) {
+        Inner* in = as_inner(ref);
+        switch (in->kind) {
+        case Kind::node4: {
+            auto* n = static_cast<Node4*>(in);
+            if (n->count < 4) return insert_sorted(n, byte, child);
+            auto* big = grow_header<Node16>(n);
+            std::copy(n->keys, n->keys + 4, big->keys);
+            std::copy(n->children, n->children + 4, big->children);
+            delete n;
+            ref = big;
+            return insert_sorted(big, byte, child);
+        }
+        case Kind::node16: {
+            auto* n = static_cast<Node16*>(in);
+            if (n->count < 16) return insert_sorted(n, byte, child);
+            auto* big = grow_header<Node48>(n);
+            for (std::uint8_t i = 0; i < 16; ++i) {
+                big->index[n->keys[i]] = static_cast<std::uint8_t>(i + 1);
+                big->children[i] = n->children[i];
+            }
+            delete n;
+            ref = big;
+            return add_child(ref, byte, child);
+        }
+        case Kind::node48: {
+            auto* n = static_cast<Node48*>(in);
+            if (n->count < 48) {
+                n->children[n->count] = child;
+                n->index[byte] = static_cast<std::uint8_t>(++n->count);
+                return;
+            }
+            auto* big = grow_header<Node256>(n);
+            for (std::size_t b = 0; b < 256; ++b)
+                if (n->index[b]) big->children[b] = n->children[n->index[b] - 1];
+            delete n;
+            ref = big;
+            return add_child(ref, byte, child);
+        }
+        case Kind::node256: {
+            auto* n = static_cast<Node256*>(in);
+            n->children[byte] = child;
+            ++n->count;
+            return;
+        }
+        default:
+            return;
+        }
+    }
+
+    // Calls f(byte, child) in ascending byte order; stops when f returns false
+    template<typename F>
+    static bool for_each_child(Inner* in, F&& f) {
+        switch (in->kind) {
+        case Kind::node4: {
+            auto* n = static_cast<Node4*>(in);
+            for (std::size_t i = 0; i < n->count; ++i)
+                if (!f(n->keys[i], n->children[i])) return false;
+            return true;
+        }
+        case Kind::node16: {
+            auto* n = static_cast<Node16*>(in);
+            for (std::size_t i = 0; i < n->count; ++i)
+                if (!f(n->keys[i], n->children[i])) return false;
+            return true;
+        }
+        case Kind::node48: {
+            auto* n = static_cast<Node48*>(in);
+            for (std::size_t b = 0; b < 256; ++b)
+                if (n->index[b] && !f(static_cast<std::uint8_t>(b), n->children[n->index[b] - 1])) return false;
+            return true;
+        }
+        case Kind::node256: {
+            auto* n = static_cast<Node256*>(in);
+            for (std::size_t b = 0; b < 256; ++b)
+                if (n->children[b] && !f(static_cast<std::uint8_t>(b), n->children[b])) return false;
+            return true;
+        }
+        default:
+            return true;
+        }
+    }
+
+    static void destroy(Node* n) {
+        if (!n) return;
+        if (n->kind == Kind::leaf) {
+            delete as_leaf(n);
+            return;
+        }
+        Inner* in = as_inner(n);
+        delete in->terminal;
+        for_each_child(in, [](std::uint8_t, Node* child) { destroy(child); return true; });
+        switch (n->kind) {
+        case Kind::node4: delete static_cast<Node4*>(n); break;
+        case Kind::node16: delete static_cast<Node16*>(n); break;
+        case Kind::node48: delete static_cast<Node48*>(n); break;
+        case Kind::node256: delete static_cast<Node256*>(n); break;
+        default: break;
+        }
+    }
+
+    static std::size_t string_heap(const std::string& s) {
+        return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+    }
+
+    static std::size_t node_bytes(Node* n) {
+        if (!n) return 0;
+        if (n->kind == Kind::leaf) return sizeof(Leaf) + string_heap(as_leaf(n)->suffix);
+        Inner* in = as_inner(n);
+        std::size_t bytes = string_heap(in->prefix) + node_bytes(in->terminal);
+        switch (n->kind) {
+        case Kind::node4: bytes += sizeof(Node4); break;
+        case Kind::node16: bytes += sizeof(Node16); break;
+        case Kind::node48: bytes += sizeof(Node48); break;
+        default: bytes += sizeof(Node256); break;
+        }
+        for_each_child(in, [&](std::uint8_t, Node* child) { bytes += node_bytes(child); return true; });
+        return bytes;
+    }
+
+    // Places leaf under node n at the byte following a shared prefix
+    static void attach(Node*& n, Leaf* leaf) {
+        if (leaf->suffix.empty()) {
+            as_inner(n)->terminal = leaf;
+        } else {
+            auto byte = static_cast<std::uint8_t>(leaf->suffix[0]);
+            leaf->suffix.erase(0, 1);
+            add_child(n, byte, leaf);
+        }
+    }
+
+    bool insert_at(Node*& ref, std::string_view key, std::size_t depth, const T& value) {
+        std::string_view rest = key.substr(depth);
+        if (!ref) {
+            ref = new Leaf(rest, value);
+            return true;
+        }
+
+        if (ref->kind == Kind::leaf) {
+            Leaf* leaf = as_leaf(ref);
+            if (leaf->suffix == rest) return false;
+            // Split: a Node4 holds the common part, both leaves hang below it
+            auto mismatch = std::mismatch(leaf->suffix.begin(), leaf->suffix.end(), rest.begin(), rest.end());
+            std::size_t p = static_cast<std::size_t>(mismatch.first - leaf->suffix.begin());
+            Node* split = new Node4();
+            as_inner(split)->prefix.assign(rest.substr(0, p));
+            leaf->suffix.erase(0, p);
+            attach(split, leaf);
+            attach(split, new Leaf(rest.substr(p), value));
+            ref = split;
+            return true;
+        }
+
+        Inner* in = as_inner(ref);
+        auto mismatch = std::mismatch(in->prefix.begin(), in->prefix.end(), rest.begin(), rest.end());
+        std::size_t p = static_cast<std::size_t>(mismatch.first - in->prefix.begin());
+        if (p < in->prefix.size()) {
+            // The key leaves the compressed path early: split the prefix
+            Node* split = new Node4();
+            as_inner(split)->prefix.assign(in->prefix, 0, p);
+            auto byte = static_cast<std::uint8_t>(in->prefix[p]);
+            in->prefix.erase(0, p + 1);
+            add_child(split, byte, in);
+            attach(split, new Leaf(rest.substr(p), value));
+            ref = split;
+            return true;
+        }
+
+        depth += in->prefix.size();
+        if (depth == key.size()) {
+            if (in->terminal) return false;
+            in->terminal = new Leaf("", value);
+            return true;
+        }
+        auto byte = static_cast<std::uint8_t>(key[depth]);
+        if (Node** child = find_child(in, byte)) return insert_at(*child, key, depth + 1, value);
+        add_child(ref, byte, new Leaf(key.substr(depth + 1), value));
+        return true;
+    }
+
+    // In-order walk of keys >= bound (or all keys when !bounded); path holds the key so far
+    template<typename F>
+    bool scan(Node* n, std::string& path, std::string_view bound, bool bounded, F& f) const {
+        std::size_t mark = path.size();
+        if (n->kind == Kind::leaf) {
+            Leaf* leaf = as_leaf(n);
+            path += leaf->suffix;
+            bool go = (bounded && path < bound) || f(std::string_view(path), leaf->value);
+            path.resize(mark);
+            return go;
+        }
+
+        Inner* in = as_inner(n);
+        path += in->prefix;
+        if (bounded) {
+            std::string_view rest = bound.substr(std::min(mark, bound.size()));
+            int cmp = std::string_view(in->prefix).compare(rest.substr(0, in->prefix.size()));
+            if (cmp < 0) {
+                path.resize(mark);
+                return true;  // Whole subtree sorts before the bound
+            }
+            if (cmp > 0 || rest.size() <= in->prefix.size()) bounded = false;
+        }
+
+        bool go = true;
+        if (in->terminal && !bounded) go = f(std::string_view(path), in->terminal->value);
+        if (go) {
+            std::size_t depth = path.size();
+            go = for_each_child(in, [&](std::uint8_t byte, Node* child) {
+                bool child_bounded = false;
+                if (bounded) {
+                    auto b = static_cast<std::uint8_t>(bound[depth]);
+                    if (byte < b) return true;
+                    child_bounded = byte == b;
+                }
+                path.push_back(static_cast<char>(byte));
+                bool result = scan(child, path, bound, child_bounded, f);
+                path.pop_back();
+                return result;
+            });
+        }
+        path.resize(mark);
+        return go;
+    }
+
+public:
+    art_map() = default;
+    art_map(const art_map&) = delete;
+    art_map& operator=(const art_map&) = delete;
+    ~art_map() { destroy(root); }
+
+    std::size_t size() const { return element_count; }
+    bool empty() const { return element_count == 0; }
+
+    // Approximate heap footprint: nodes, leaves and out-of-line string buffers
+    std::size_t memory_bytes() const { return node_bytes(root); }
+
+    bool insert(std::string_view key, const T& value) {
+        bool inserted = insert_at(root, key, 0, value);
+        element_count += inserted;
+        return inserted;
+    }
+
+    const T* find(std::string_view key) const {
+        Node* n = root;
+        std::size_t depth = 0;
+        while (n) {
+            if (n->kind == Kind::leaf) {
+                Leaf* leaf = as_leaf(n);
+                return key.substr(depth) == leaf->suffix ? &leaf->value : nullptr;
+            }
+            Inner* in = as_inner(n);
+            if (key.substr(depth, in->prefix.size()) != in->prefix) return nullptr;
+            depth += in->prefix.size();
+            if (depth == key.size()) return in->terminal ? &in->terminal->value : nullptr;
+            Node** child = find_child(in, static_cast<std::uint8_t>(key[depth]));
+            n = child ? *child : nullptr;
+            ++depth;
+        }
+        return nullptr;
+    }
+
+    bool contains(std::string_view key) const { return find(key) != nullptr; }
+
+    // Visits keys in ascending order; f(key, value) returns false to stop
+    template<typename F>
+    void for_each(F f) const {
+        std::string path;
+        if (root) scan(root, path, {}, false, f);
+    }
+
+    // Visits keys >= bound in ascending order
+    template<typename F>
+    void for_each_from(std::string_view bound, F f) const {
+        std::string path;
+        if (root) scan(root, path, bound, true, f);
+    }
+
+    // First key >= bound, with its value
+    std::optional<std::pair<std::string, T>> lower_bound(std::string_view bound) const {
+        std::optional<std::pair<std::string, T>> result;
+        for_each_from(bound, [&](std::string_view k, const T& v) {
+            result.emplace(std::string(k), v);
+            return false;
+        });
+        return result;
+    }
+
+    // Visits every key that starts with prefix, in order
+    template<typename F>
+    std::size_t for_each_with_prefix(std::string_view prefix, F f) const {
+        std::size_t visited = 0;
+        for_each_from(prefix, [&](std::string_view k, const T& v) {
+            if (!k.starts_with(prefix)) return false;
+            ++visited;
+            f(k, v);
+            return true;
+        });
+        return visited;
+    }
+};
+
+// Path- and URL-like keys with long shared prefixes
+inline std::vector<std::string> make_realistic_keys(std::size_t n, std::uint64_t seed = 7) {
+    static constexpr std::string_view roots[] = {
+        "/usr/share/doc/", "/usr/lib/x86_64-linux-gnu/", "/home/build/project/src/",
+        "https://api.example.com/v1/users/", "https://cdn.example.com/assets/img/",
+    };
+    cpp26_benchmark::SplitMix64 rng(seed);
+    std::vector<std::string> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint64_t r = rng.next();
+        keys.push_back(std::format("{}pkg{}/module{}/item{}.dat", roots[r % 5], (r >> 8) % 512,
+                                   (r >> 20) % 64, (r >> 32) % 100000));
+    }
+    return keys;
+}
+
+void demonstrate_art() {
+    std::cout << "\n=== ADAPTIVE RADIX TREE ===\n";
+
+    art_map<int> tree;
+    for (std::string_view k : {"apple", "banana", "cherry", "date", "app", "application", "band", "bandana"})
+        tree.insert(k, static_cast<int>(k.size()));
+    std::cout << std::format("Inserted 8 keys (size {}), insert(\"apple\") again: {}\n",
+                             tree.size(), tree.insert("apple", 0));
+
+    std::cout << "In order: ";
+    tree.for_each([](std::string_view k, int v) {
+        std::cout << k << "=" << v << " ";
+        return true;
+    });
+    std::cout << "\n";
+
+    std::cout << std::format("find(\"banana\")={}, contains(\"ban\")={}, contains(\"bandana\")={}\n",
+                             *tree.find("banana"), tree.contains("ban"), tree.contains("bandana"));
+
+    if (auto lb = tree.lower_bound("b")) std::cout << "lower_bound(\"b\"): " << lb->first << "\n";
+    if (auto lb = tree.lower_bound("bane")) std::cout << "lower_bound(\"bane\"): " << lb->first << "\n";
+    if (!tree.lower_bound("zebra")) std::cout << "lower_bound(\"zebra\"): end\n";
+
+    std::cout << "Prefix \"app\": ";
+    tree.for_each_with_prefix("app", [](std::string_view k, int) { std::cout << k << " "; });
+    std::cout << "\n";
+
+    // Node types adapt as fan-out grows
+    art_map<int> wide;
+    for (int c = 0; c < 200; ++c) wide.insert(std::string(1, static_cast<char>(c + 32)) + "x", c);
+    std::cout << std::format("200 distinct first bytes: size {}, ~{} bytes\n", wide.size(), wide.memory_bytes());
+}
+
+// ============================================================================
+// BENCHMARK - std::map<std::string, int> vs art_map<int> on path/URL keys
+// ============================================================================
+void demonstrate_art_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== ADAPTIVE RADIX TREE BENCHMARK ===\n";
+
+    const std::size_t n = scaled(200'000);
+    auto keys = make_realistic_keys(n);
+    SplitMix64 rng(11);
+    std::vector<std::string_view> probes(scaled(1 << 20));
+    for (auto& p : probes) p = keys[rng.next() % n];
+
+    std::map<std::string, int, std::less<>> map;
+    art_map<int> art;
+    std::cout << std::format("{} keys like \"{}\":\n", n, keys[0]);
+    print_result("std::map insert", time_ms([&] {
+        for (std::size_t i = 0; i < n; ++i) map.emplace(keys[i], static_cast<int>(i));
+    }), n);
+    print_result("art_map insert", time_ms([&] {
+        for (std::size_t i = 0; i < n; ++i) art.insert(keys[i], static_cast<int>(i));
+    }), n);
+
+    print_result("std::map find", best_of_ms(3, [&] {
+        long sum = 0;
+        for (auto p : probes) sum += map.find(p)->second;
+        do_not_optimize(sum);
+    }), probes.size());
+    print_result("art_map find", best_of_ms(3, [&] {
+        long sum = 0;
+        for (auto p : probes) sum += *art.find(p);
+        do_not_optimize(sum);
+    }), probes.size());
+
+    const std::string prefix = "/usr/lib/x86_64-linux-gnu/pkg1";
+    std::size_t map_hits = 0, art_hits = 0;
+    double map_ms = best_of_ms(3, [&] {
+        map_hits = 0;
+        for (auto it = map.lower_bound(prefix); it != map.end() && it->first.starts_with(prefix); ++it) ++map_hits;
+    });
+    double art_ms = best_of_ms(3, [&] {
+        art_hits = art.for_each_with_prefix(prefix, [](std::string_view, int) {});
+    });
+    std::cout << std::format("prefix scan \"{}\" ({} keys):\n", prefix, map_hits);
+    print_result("std::map lower_bound + ++", map_ms, map_hits);
+    print_result("art_map for_each_with_prefix", art_ms, art_hits);
+
+    // std::map node: header (color + 3 pointers) + pair, plus the key's heap buffer
+    std::size_t map_bytes = 0;
+    for (const auto& [k, v] : map)
+        map_bytes += 32 + sizeof(std::pair<const std::string, int>) + (k.capacity() > 15 ? k.capacity() + 1 : 0);
+    std::cout << std::format("  memory: std::map ~{:.1f} MiB, art_map ~{:.1f} MiB (before malloc overhead)\n",
+                             map_bytes / 1048576.0, art.memory_bytes() / 1048576.0);
+}
+
+void run_all_demos() {
+    demonstrate_art();
+    demonstrate_art_benchmark();
+}
+
+} // namespace cpp26_art
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <iostream>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <functional>
+#include <utility>
+#include <format>
+
+// ============================================================================
+// BENCHMARK HELPERS - Shared timing utilities for the container benchmarks
+// Workload sizes are multiplied by CPP26_BENCH_SCALE (set from CMake) so the
+// interactive demos stay fast while larger runs remain one flag away.
+// ============================================================================
+#ifndef CPP26_BENCH_SCALE
+#define CPP26_BENCH_SCALE 1
+#endif
+
+namespace cpp26_benchmark {
+
+inline constexpr std::size_t scale = CPP26_BENCH_SCALE;
+
+// Scales a base workload size by CPP26_BENCH_SCALE
+constexpr std::size_t scaled(std::size_t n) {
+    return n * scale;
+}
+
+// Keeps the optimizer from discarding a benchmark result
+template<typename T>
+void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Runs func once and returns the elapsed wall-clock time in milliseconds
+template<typename Func>
+double time_ms(Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Runs func `repetitions` times and returns the fastest run in milliseconds
+template<typename Func>
+double best_of_ms(int repetitions, Func&& func) {
+    double best = time_ms(func);
+    for (int i = 1; i < repetitions; ++i) {
+        double t = time_ms(func);
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+// Deterministic 64-bit generator for benchmark keys (splitmix64)
+class SplitMix64 {
+private:
+    std::uint64_t state;
+
+public:
+    explicit SplitMix64(std::uint64_t seed = 0x9E3779B97F4A7C15ull) : state(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
+
+// Prints one result row: label, total time and nanoseconds per operation
+inline void print_result(const std::string& label, double ms, std::size_t operations) {
+    double ns_per_op = operations ? (ms * 1e6) / static_cast<double>(operations) : 0.0;
+    std::cout << std::format("  {:<36} {:>10.2f} ms  {:>9.1f} ns/op\n", label, ms, ns_per_op);
+}
+
+// ============================================================================
+// GRAPH FIXTURE - Random sparse digraph and reference shortest paths
+// Shared by the priority queue benchmarks (d-ary, multi-, radix heaps)
+// ============================================================================
+struct graph {
+    std::vector<std::uint32_t> offsets;  // CSR: edges of v are [offsets[v], offsets[v + 1])
+    std::vector<std::uint32_t> targets;
+    std::vector<std::uint32_t> weights;
+
+    std::size_t vertices() const { return offsets.size() - 1; }
+};
+
+// n vertices with `degree` random out-edges each, weights in [1, max_weight]
+inline graph random_graph(std::size_t n, std::size_t degree, std::uint64_t seed, std::uint32_t max_weight = 1000) {
+    SplitMix64 rng(seed);
+    graph g;
+    g.offsets.resize(n + 1);
+    for (std::size_t v = 0; v < n; ++v) {
+        g.offsets[v] = static_cast<std::uint32_t>(g.targets.size());
+        for (std::size_t e = 0; e < degree; ++e) {
+            g.targets.push_back(static_cast<std::uint32_t>(rng.next() % n));
+            g.weights.push_back(static_cast<std::uint32_t>(1 + rng.next() % max_weight));
+        }
+    }
+    g.offsets[n] = static_cast<std::uint32_t>(g.targets.size());
+    return g;
+}
+
+inline constexpr std::uint64_t unreachable = std::numeric_limits<std::uint64_t>::max();
+
+// Distances from source: std::priority_queue with lazy deletion
+inline std::vector<std::uint64_t> dijkstra(const graph& g, std::uint32_t source) {
+    using item = std::pair<std::uint64_t, std::uint32_t>;
+    std::vector<std::uint64_t> dist(g.vertices(), unreachable);
+    std::priority_queue<item, std::vector<item>, std::greater<item>> pq;
+    dist[source] = 0;
+    pq.push({0, source});
+    while (!pq.empty()) {
+        auto [d, v] = pq.top();
+        pq.pop();
+        if (d != dist[v]) continue;
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint64_t nd = d + g.weights[e];
+            if (nd < dist[g.targets[e]]) {
+                dist[g.targets[e]] = nd;
+                pq.push({nd, g.targets[e]});
+            }
+        }
+    }
+    return dist;
+}
+
+} // namespace cpp26_benchmark
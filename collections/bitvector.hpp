@@ -0,0 +1,433 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_bitvector {
+
+// ============================================================================
+// BITVECTOR - Packed bits with word-level bulk ops, rank and select
+// Replaces std::vector<bool> for large filters: operations work on whole
+// 64-bit words (256 bits at a time with AVX2), count() uses hardware popcount,
+// and a small rank9-style index answers rank/select in constant time.
+// Build with -march=native (CMake: -DCPP26_NATIVE_ARCH=ON) to enable the
+// AVX2/BMI2 paths; otherwise portable std::popcount/std::countr_zero are used.
+// Reference: https://en.cppreference.com/w/cpp/header/bit
+// ============================================================================
+class BitVector {
+private:
+    static constexpr std::size_t word_bits = 64;
+    static constexpr std::size_t block_words = 8;     // One 512-bit cache line
+    static constexpr std::size_t select_sample = 512; // Every 512th one is sampled
+
+    std::vector<std::uint64_t> words;
+    std::size_t bits = 0;
+
+    // Rank index: absolute count before each block, plus seven packed
+    // 9-bit counts (relative to the block) before words 1..7
+    std::vector<std::uint64_t> block_rank;
+    std::vector<std::uint64_t> word_rank;
+    // Select index: block containing every select_sample-th one
+    std::vector<std::uint32_t> select_blocks;
+    std::size_t total_ones = 0;
+    bool index_valid = false;
+
+    // Storage is padded to whole 256-bit lanes so SIMD loops need no scalar tail
+    static std::size_t word_count(std::size_t n) { return ((n + 255) / 256) * 4; }
+
+    // Clears the bits past size() so counts and NOT stay exact
+    void trim_tail() {
+        std::size_t live = (bits + word_bits - 1) / word_bits;
+        if (bits % word_bits != 0) {
+            words[live - 1] &= (std::uint64_t{1} << (bits % word_bits)) - 1;
+        }
+        std::fill(words.begin() + live, words.end(), 0);
+    }
+
+    void require_index() const {
+        if (!index_valid) throw std::logic_error("BitVector: call build_index() after modifying");
+    }
+
+    enum class BitOp { And, Or, Xor, AndNot };
+
+    template<BitOp Op>
+    static std::uint64_t apply(std::uint64_t a, std::uint64_t b) {
+        if constexpr (Op == BitOp::And) return a & b;
+        else if constexpr (Op == BitOp::Or) return a | b;
+        else if constexpr (Op == BitOp::Xor) return a ^ b;
+        else return a & ~b;
+    }
+
+#if defined(__AVX2__)
+    template<BitOp Op>
+    static __m256i apply(__m256i a, __m256i b) {
+        if constexpr (Op == BitOp::And) return _mm256_and_si256(a, b);
+        else if constexpr (Op == BitOp::Or) return _mm256_or_si256(a, b);
+        else if constexpr (Op == BitOp::Xor) return _mm256_xor_si256(a, b);
+        else return _mm256_andnot_si256(b, a);
+    }
+#endif
+
+    template<BitOp Op>
+    void combine(const BitVector& other) {
+        if (other.bits != bits) throw std::invalid_argument("BitVector: size mismatch");
+        std::uint64_t* a = words.data();
+        const std::uint64_t* b = other.words.data();
+#if defined(__AVX2__)
+        for (std::size_t i = 0; i < words.size(); i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), apply<Op>(va, vb));
+        }
+#else
+        for (std::size_t i = 0; i < words.size(); ++i) a[i] = apply<Op>(a[i], b[i]);
+#endif
+        index_valid = false;
+    }
+
+    // Position of the r-th (0-based) set bit inside a word
+    static unsigned select_in_word(std::uint64_t word, unsigned r) {
+#if defined(__BMI2__)
+        return static_cast<unsigned>(std::countr_zero(_pdep_u64(std::uint64_t{1} << r, word)));
+#else
+        for (unsigned i = 0; i < r; ++i) word &= word - 1;  // Drop the r lowest ones
+        return static_cast<unsigned>(std::countr_zero(word));
+#endif
+    }
+
+#if defined(__AVX2__)
+    // Mula's nibble-lookup popcount: 256 bits per iteration
+    static std::uint64_t popcount_avx2(const std::uint64_t* data, std::size_t n, std::size_t& done) {
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_mask = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low_mask));
+            __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+            // Sum bytes into four 64-bit lanes; each lane gains at most 64 per iteration
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+        }
+        done = i;
+        return static_cast<std::uint64_t>(_mm256_extract_epi64(acc, 0)) +
+               static_cast<std::uint64_t>(_mm256_extract_epi64(acc, 1)) +
+               static_cast<std::uint64_t>(_mm256_extract_epi64(acc, 2)) +
+               static_cast<std::uint64_t>(_mm256_extract_epi64(acc, 3));
+    }
+#endif
+
+public:
+    BitVector() = default;
+
+    explicit BitVector(std::size_t n, bool value = false)
+        : words(word_count(n), value ? ~std::uint64_t{0} : 0), bits(n) {
+        if (!words.empty()) trim_tail();
+    }
+
+    // Capacity
+    std::size_t size() const { return bits; }
+    bool empty() const { return bits == 0; }
+    std::size_t size_in_bytes() const { return words.size() * sizeof(std::uint64_t); }
+
+    void resize(std::size_t n) {
+        words.resize(word_count(n), 0);
+        bits = n;
+        if (!words.empty()) trim_tail();
+        index_valid = false;
+    }
+
+    // Bit access - no proxy objects, plain bool in and out
+    bool test(std::size_t i) const { return (words[i / word_bits] >> (i % word_bits)) & 1; }
+    bool operator[](std::size_t i) const { return test(i); }
+
+    void set(std::size_t i) {
+        words[i / word_bits] |= std::uint64_t{1} << (i % word_bits);
+        index_valid = false;
+    }
+
+    void reset(std::size_t i) {
+        words[i / word_bits] &= ~(std::uint64_t{1} << (i % word_bits));
+        index_valid = false;
+    }
+
+    void assign(std::size_t i, bool value) { value ? set(i) : reset(i); }
+
+    std::span<const std::uint64_t> data() const { return words; }
+    std::span<std::uint64_t> data() {
+        index_valid = false;
+        return words;
+    }
+
+    // Bulk word-level operations
+    BitVector& operator&=(const BitVector& o) { combine<BitOp::And>(o); return *this; }
+    BitVector& operator|=(const BitVector& o) { combine<BitOp::Or>(o); return *this; }
+    BitVector& operator^=(const BitVector& o) { combine<BitOp::Xor>(o); return *this; }
+
+    // AND NOT: keeps bits of *this that are clear in o (filter exclusion)
+    BitVector& and_not(const BitVector& o) { combine<BitOp::AndNot>(o); return *this; }
+
+    // NOT in place
+    BitVector& flip() {
+        for (auto& w : words) w = ~w;
+        if (!words.empty()) trim_tail();
+        index_valid = false;
+        return *this;
+    }
+
+    friend BitVector operator&(BitVector a, const BitVector& b) { return a &= b; }
+    friend BitVector operator|(BitVector a, const BitVector& b) { return a |= b; }
+    friend BitVector operator^(BitVector a, const BitVector& b) { return a ^= b; }
+    friend BitVector operator~(BitVector a) { return a.flip(); }
+
+    // Number of set bits (AVX2 nibble lookup, then hardware popcount for the tail)
+    std::size_t count() const {
+        std::size_t i = 0;
+        std::uint64_t total = 0;
+#if defined(__AVX2__)
+        total = popcount_avx2(words.data(), words.size(), i);
+#endif
+        for (; i < words.size(); ++i) total += std::popcount(words[i]);
+        return static_cast<std::size_t>(total);
+    }
+
+    bool any() const {
+        return std::any_of(words.begin(), words.end(), [](std::uint64_t w) { return w != 0; });
+    }
+    bool none() const { return !any(); }
+
+    // Calls func(index) for every set bit, skipping zero words entirely
+    template<typename Func>
+    void for_each_set_bit(Func&& func) const {
+        for (std::size_t w = 0; w < words.size(); ++w) {
+            std::uint64_t word = words[w];
+            while (word != 0) {
+                func(w * word_bits + static_cast<std::size_t>(std::countr_zero(word)));  // tzcnt
+                word &= word - 1;  // Clear lowest set bit (blsr)
+            }
+        }
+    }
+
+    // Materializes the set-bit positions, e.g. as row ids for a filter
+    std::vector<std::uint32_t> to_indices() const {
+        std::vector<std::uint32_t> out;
+        out.reserve(count());
+        for_each_set_bit([&out](std::size_t i) { out.push_back(static_cast<std::uint32_t>(i)); });
+        return out;
+    }
+
+    // Builds the rank/select index (about 3% extra space); required after mutation
+    void build_index() {
+        std::size_t blocks = (words.size() + block_words - 1) / block_words;
+        block_rank.assign(blocks + 1, 0);
+        word_rank.assign(blocks, 0);
+        select_blocks.clear();
+
+        std::uint64_t running = 0;
+        for (std::size_t b = 0; b < blocks; ++b) {
+            block_rank[b] = running;
+            std::uint64_t relative = 0;
+            std::uint64_t packed = 0;
+            for (std::size_t k = 0; k < block_words; ++k) {
+                if (k > 0) packed |= relative << (9 * (k - 1));
+                std::size_t w = b * block_words + k;
+                std::uint64_t ones = w < words.size() ? std::popcount(words[w]) : 0;
+                // Record the block of every sampled one as it is passed
+                while ((running + relative + ones) > select_blocks.size() * select_sample) {
+                    select_blocks.push_back(static_cast<std::uint32_t>(b));
+                }
+                relative += ones;
+            }
+            word_rank[b] = packed;
+            running += relative;
+        }
+        block_rank[blocks] = running;
+        total_ones = running;
+        index_valid = true;
+    }
+
+    // Number of ones in [0, i)
+    std::size_t rank1(std::size_t i) const {
+        require_index();
+        std::size_t w = i / word_bits;
+        std::size_t b = w / block_words;
+        std::size_t k = w % block_words;
+        std::uint64_t r = block_rank[b];
+        if (k > 0) r += (word_rank[b] >> (9 * (k - 1))) & 0x1FF;
+        if (i % word_bits != 0) {
+            r += std::popcount(words[w] & ((std::uint64_t{1} << (i % word_bits)) - 1));
+        }
+        return static_cast<std::size_t>(r);
+    }
+
+    std::size_t rank0(std::size_t i) const { return i - rank1(i); }
+
+    // Position of the k-th one (0-based); size() if k >= count()
+    std::size_t select1(std::size_t k) const {
+        require_index();
+        if (k >= total_ones) return bits;
+
+        // Consecutive samples bracket the block; sparse regions put many
+        // blocks between them, so binary-search the block ranks in between
+        std::size_t s = k / select_sample;
+        std::size_t lo = select_blocks[s];
+        std::size_t hi = s + 1 < select_blocks.size() ? select_blocks[s + 1] : block_rank.size() - 2;
+        std::size_t b = static_cast<std::size_t>(
+            std::upper_bound(block_rank.begin() + static_cast<std::ptrdiff_t>(lo) + 1,
+                             block_rank.begin() + static_cast<std::ptrdiff_t>(hi) + 1, std::uint64_t{k}) -
+            block_rank.begin()) - 1;
+
+        std::uint64_t remaining = k - block_rank[b];
+        std::size_t word = 0;
+        for (std::size_t j = block_words - 1; j > 0; --j) {
+            std::uint64_t before = (word_rank[b] >> (9 * (j - 1))) & 0x1FF;
+            if (before <= remaining) {
+                word = j;
+                remaining -= before;
+                break;
+            }
+        }
+        std::size_t w = b * block_words + word;
+        return w * word_bits + select_in_word(words[w], static_cast<unsigned>(remaining));
+    }
+};
+
+void demonstrate_bitvector() {
+    std::cout << "\n=== BITVECTOR (Bulk Ops, Rank, Select) ===\n";
+
+#if defined(__AVX2__)
+    std::cout << "Bulk ops and count(): AVX2\n";
+#else
+    std::cout << "Bulk ops and count(): scalar (build with -march=native for AVX2)\n";
+#endif
+
+    BitVector even(20), low(20);
+    for (std::size_t i = 0; i < 20; i += 2) even.set(i);
+    for (std::size_t i = 0; i < 10; ++i) low.set(i);
+
+    auto print = [](const char* label, const BitVector& bv) {
+        std::cout << label;
+        for (std::size_t i = 0; i < bv.size(); ++i) std::cout << (bv[i] ? '1' : '0');
+        std::cout << std::format("  (count={})\n", bv.count());
+    };
+
+    print("even:        ", even);
+    print("low:         ", low);
+    print("even & low:  ", even & low);
+    print("even | low:  ", even | low);
+    print("even ^ low:  ", even ^ low);
+    print("~even:       ", ~even);
+
+    BitVector filter = even;
+    filter.and_not(low);
+    print("even & ~low: ", filter);
+
+    std::cout << "Set bits of even|low via tzcnt: ";
+    (even | low).for_each_set_bit([](std::size_t i) { std::cout << i << " "; });
+    std::cout << "\n";
+
+    // rank/select need the index
+    even.build_index();
+    std::cout << std::format("rank1(7)={} (ones before bit 7), rank0(7)={}\n", even.rank1(7), even.rank0(7));
+    std::cout << std::format("select1(3)={} (position of 4th one)\n", even.select1(3));
+
+    even.set(1);
+    try {
+        even.rank1(5);
+    } catch (const std::logic_error& e) {
+        std::cout << "After set(1) without rebuild: " << e.what() << "\n";
+    }
+}
+
+// ============================================================================
+// BITVECTOR vs VECTOR<BOOL> BENCHMARK
+// ============================================================================
+void demonstrate_bitvector_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== BITVECTOR vs VECTOR<BOOL> BENCHMARK ===\n";
+
+    const std::size_t n = scaled(16'000'000);
+    SplitMix64 rng;
+
+    std::vector<bool> va(n), vb(n);
+    BitVector ba(n), bb(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint64_t r = rng.next();
+        bool x = (r % 10) == 0;       // ~10% density
+        bool y = ((r >> 32) % 2) == 0; // ~50% density
+        va[i] = x;
+        vb[i] = y;
+        ba.assign(i, x);
+        bb.assign(i, y);
+    }
+    std::cout << std::format("{} bits ({:.1f} MiB packed, vector<bool> is similar but bit-at-a-time)\n",
+                             n, ba.size_in_bytes() / 1048576.0);
+
+    print_result("count     vector<bool>", best_of_ms(3, [&] {
+        do_not_optimize(std::count(va.begin(), va.end(), true));
+    }), n);
+    print_result("count     BitVector", best_of_ms(3, [&] {
+        do_not_optimize(ba.count());
+    }), n);
+
+    print_result("AND       vector<bool>", best_of_ms(3, [&] {
+        std::vector<bool> out(n);
+        for (std::size_t i = 0; i < n; ++i) out[i] = va[i] && vb[i];
+        do_not_optimize(out);
+    }), n);
+    print_result("AND       BitVector", best_of_ms(3, [&] {
+        BitVector out = ba & bb;
+        do_not_optimize(out);
+    }), n);
+
+    print_result("iterate   vector<bool>", best_of_ms(3, [&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i) if (va[i]) sum += i;
+        do_not_optimize(sum);
+    }), n);
+    print_result("iterate   BitVector (tzcnt)", best_of_ms(3, [&] {
+        std::size_t sum = 0;
+        ba.for_each_set_bit([&sum](std::size_t i) { sum += i; });
+        do_not_optimize(sum);
+    }), n);
+
+    double t_build = time_ms([&] { ba.build_index(); });
+    print_result("build rank/select index", t_build, n);
+
+    const std::size_t queries = 1'000'000;
+    std::vector<std::size_t> positions(queries);
+    for (auto& p : positions) p = rng.next() % n;
+    std::size_t ones = ba.count();
+
+    print_result("rank1     BitVector", best_of_ms(3, [&] {
+        std::size_t sum = 0;
+        for (auto p : positions) sum += ba.rank1(p);
+        do_not_optimize(sum);
+    }), queries);
+    print_result("select1   BitVector", best_of_ms(3, [&] {
+        std::size_t sum = 0;
+        for (auto p : positions) sum += ba.select1(p % ones);
+        do_not_optimize(sum);
+    }), queries);
+}
+
+void run_all_demos() {
+    demonstrate_bitvector();
+    demonstrate_bitvector_benchmark();
+}
+
+} // namespace cpp26_bitvector
@@ -0,0 +1,562 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <stdexcept>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_btree {
+
+// ============================================================================
+// IN-NODE SEARCH - Count keys below (or at) a probe without branching
+// A node holds a few dozen keys, so a linear SIMD count beats binary search:
+// no mispredictions and every cache line is read once. 32- and 64-bit integer
+// keys use AVX2 compares; other key types fall back to a branch-free loop.
+// ============================================================================
+template<bool Inclusive, typename Key>
+std::size_t count_keys_before(const Key* keys, std::size_t n, const Key& key) {
+    std::size_t count = 0, i = 0;
+#if defined(__AVX2__)
+    if constexpr (std::is_integral_v<Key> && sizeof(Key) == 8) {
+        // Signed 64-bit compare; unsigned keys are shifted by flipping the top bit
+        const __m256i flip = _mm256_set1_epi64x(std::is_unsigned_v<Key> ? INT64_MIN : 0);
+        const __m256i probe = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), flip);
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+            __m256i past = Inclusive ? _mm256_cmpgt_epi64(v, probe) : _mm256_cmpgt_epi64(probe, v);
+            int mask = _mm256_movemask_pd(_mm256_castsi256_pd(past));
+            count += Inclusive ? 4 - std::popcount(static_cast<unsigned>(mask)) : std::popcount(static_cast<unsigned>(mask));
+        }
+    } else if constexpr (std::is_integral_v<Key> && sizeof(Key) == 4) {
+        const __m256i flip = _mm256_set1_epi32(std::is_unsigned_v<Key> ? INT32_MIN : 0);
+        const __m256i probe = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(key)), flip);
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+            __m256i past = Inclusive ? _mm256_cmpgt_epi32(v, probe) : _mm256_cmpgt_epi32(probe, v);
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(past));
+            count += Inclusive ? 8 - std::popcount(static_cast<unsigned>(mask)) : std::popcount(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    for (; i < n; ++i) count += Inclusive ? !(key < keys[i]) : (keys[i] < key);
+    return count;
+}
+
+// ============================================================================
+// BTREE_MAP - B+-tree ordered map with cache-line-multiple nodes
+// Values live only in leaves; inner nodes hold separator keys, so more of the
+// upper levels fit in cache. Leaves are doubly linked, making a range scan a
+// walk along contiguous key/value arrays instead of an in-order tree walk.
+// Keys are ordered by operator<. erase() is lazy: underfull leaves are not
+// merged (as in many database B+-trees); bulk_load() rebuilds compactly.
+// ============================================================================
+template<typename Key, typename T, std::size_t NodeBytes = 512>
+class btree_map {
+private:
+    static_assert(NodeBytes % 64 == 0, "NodeBytes should be a multiple of the cache line");
+
+    static constexpr std::size_t leaf_capacity =
+        std::max<std::size_t>(4, (NodeBytes - 32) / (sizeof(Key) + sizeof(T)));
+    static constexpr std::size_t inner_capacity =
+        std::max<std::size_t>(4, (NodeBytes - 16 - sizeof(void*)) / (sizeof(Key) + sizeof(void*)));
+    static constexpr std::size_t max_depth = 32;
+
+    struct Node {
+        bool leaf;
+        std::uint16_t count = 0;
+        explicit Node(bool is_leaf) : leaf(is_leaf) {}
+    };
+
+    struct alignas(64) Leaf : Node {
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+        Key keys[leaf_capacity];
+        T values[leaf_capacity];
+        Leaf() : Node(true) {}
+    };
+
+    struct alignas(64) Inner : Node {
+        Key keys[inner_capacity];
+        Node* children[inner_capacity + 1];
+        Inner() : Node(false) {}
+    };
+
+    Node* root = nullptr;
+    Leaf* head = nullptr;       // Leftmost leaf, start of iteration
+    std::size_t height = 0;     // Number of inner levels above the leaves
+    std::size_t element_count = 0;
+    std::size_t leaf_count = 0;
+    std::size_t inner_count = 0;
+
+    static Leaf* as_leaf(Node* n) { return static_cast<Leaf*>(n); }
+    static Inner* as_inner(Node* n) { return static_cast<Inner*>(n); }
+
+    Leaf* new_leaf() { ++leaf_count; return new Leaf(); }
+    Inner* new_inner() { ++inner_count; return new Inner(); }
+
+    void destroy(Node* n) {
+        if (!n) return;
+        if (n->leaf) {
+            delete as_leaf(n);
+        } else {
+            Inner* in = as_inner(n);
+            for (std::size_t i = 0; i <= in->count; ++i) destroy(in->children[i]);
+            delete in;
+        }
+    }
+
+    Leaf* rightmost_leaf() const {
+        Node* n = root;
+        for (std::size_t level = 0; level < height; ++level) n = as_inner(n)->children[as_inner(n)->count];
+        return as_leaf(n);
+    }
+
+    // Descends to the leaf that may hold key, optionally recording the path
+    Leaf* find_leaf(const Key& key, Inner** path = nullptr, std::size_t* slots = nullptr) const {
+        Node* n = root;
+        for (std::size_t level = 0; level < height; ++level) {
+            Inner* in = as_inner(n);
+            std::size_t c = count_keys_before<true>(in->keys, in->count, key);
+            if (path) {
+                path[level] = in;
+                slots[level] = c;
+            }
+            n = in->children[c];
+        }
+        return as_leaf(n);
+    }
+
+    // Adds (separator, right) next to the child at path[level]/slots[level], splitting upward
+    void insert_into_parent(Inner** path, std::size_t* slots, std::size_t level, Key separator, Node* right) {
+        while (true) {
+            if (level == 0) {
+                Inner* new_root = new_inner();
+                new_root->keys[0] = std::move(separator);
+                new_root->children[0] = root;
+                new_root->children[1] = right;
+                new_root->count = 1;
+                root = new_root;
+                ++height;
+                return;
+            }
+            --level;
+            Inner* in = path[level];
+            std::size_t c = slots[level];
+
+            Inner* target = in;
+            Inner* sibling = nullptr;
+            Key up_key{};
+            if (in->count == inner_capacity) {
+                // Split first: left keeps [0, mid), keys[mid] moves up, right takes the rest
+                std::size_t mid = inner_capacity / 2;
+                sibling = new_inner();
+                sibling->count = static_cast<std::uint16_t>(inner_capacity - mid - 1);
+                std::move(in->keys + mid + 1, in->keys + inner_capacity, sibling->keys);
+                std::copy(in->children + mid + 1, in->children + inner_capacity + 1, sibling->children);
+                up_key = std::move(in->keys[mid]);
+                in->count = static_cast<std::uint16_t>(mid);
+                if (c > mid) {
+                    target = sibling;
+                    c -= mid + 1;
+                }
+            }
+
+            std::move_backward(target->keys + c, target->keys + target->count, target->keys + target->count + 1);
+            std::copy_backward(target->children + c + 1, target->children + target->count + 1,
+                               target->children + target->count + 2);
+            target->keys[c] = std::move(separator);
+            target->children[c + 1] = right;
+            ++target->count;
+
+            if (!sibling) return;
+            separator = std::move(up_key);
+            right = sibling;
+        }
+    }
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class btree_map;
+        template<bool> friend class basic_iterator;
+        const btree_map* tree = nullptr;  // Only for stepping back from end()
+        Leaf* leaf = nullptr;
+        std::size_t index = 0;
+
+        basic_iterator(const btree_map* t, Leaf* l, std::size_t i) : tree(t), leaf(l), index(i) { skip_exhausted(); }
+
+        // Moves past the end of a leaf (and any leaves emptied by erase)
+        void skip_exhausted() {
+            while (leaf && index >= leaf->count) {
+                leaf = leaf->next;
+                index = 0;
+            }
+        }
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<Key, T>;
+        using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+        struct pointer {
+            reference ref;
+            reference* operator->() { return &ref; }
+        };
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(tree, leaf, index); }
+
+        reference operator*() const { return {leaf->keys[index], leaf->values[index]}; }
+        pointer operator->() const { return pointer{**this}; }
+
+        basic_iterator& operator++() {
+            ++index;
+            skip_exhausted();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        // Follows the prev links, skipping leaves emptied by erase; end()
+        // steps back from the rightmost leaf
+        basic_iterator& operator--() {
+            if (!leaf) {
+                leaf = tree->rightmost_leaf();
+                index = leaf->count;
+            }
+            while (index == 0) {
+                leaf = leaf->prev;
+                index = leaf->count;
+            }
+            --index;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const basic_iterator& other) const {
+            return leaf == other.leaf && index == other.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    btree_map() = default;
+    btree_map(const btree_map&) = delete;
+    btree_map& operator=(const btree_map&) = delete;
+    ~btree_map() { destroy(root); }
+
+    static constexpr std::size_t leaf_slots() { return leaf_capacity; }
+    static constexpr std::size_t inner_slots() { return inner_capacity; }
+    static constexpr std::size_t leaf_bytes() { return sizeof(Leaf); }
+    static constexpr std::size_t inner_bytes() { return sizeof(Inner); }
+
+    iterator begin() { return iterator(this, head, 0); }
+    iterator end() { return iterator(this, nullptr, 0); }
+    const_iterator begin() const { return const_iterator(this, head, 0); }
+    const_iterator end() const { return const_iterator(this, nullptr, 0); }
+
+    std::size_t size() const { return element_count; }
+    bool empty() const { return element_count == 0; }
+    std::size_t depth() const { return root ? height + 1 : 0; }
+    std::size_t memory_bytes() const { return leaf_count * sizeof(Leaf) + inner_count * sizeof(Inner); }
+
+    void clear() {
+        destroy(root);
+        root = nullptr;
+        head = nullptr;
+        height = element_count = leaf_count = inner_count = 0;
+    }
+
+    const_iterator lower_bound(const Key& key) const {
+        if (!root) return end();
+        Leaf* leaf = find_leaf(key);
+        return const_iterator(this, leaf, count_keys_before<false>(leaf->keys, leaf->count, key));
+    }
+
+    const_iterator upper_bound(const Key& key) const {
+        if (!root) return end();
+        Leaf* leaf = find_leaf(key);
+        return const_iterator(this, leaf, count_keys_before<true>(leaf->keys, leaf->count, key));
+    }
+
+    const_iterator find(const Key& key) const {
+        auto it = lower_bound(key);
+        return (it != end() && !(key < it.leaf->keys[it.index])) ? it : end();
+    }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+
+    const T& at(const Key& key) const {
+        auto it = find(key);
+        if (it == end()) throw std::out_of_range("btree_map::at");
+        return it.leaf->values[it.index];
+    }
+
+    std::pair<iterator, bool> insert(const Key& key, const T& value) {
+        if (!root) {
+            head = new_leaf();
+            root = head;
+        }
+
+        Inner* path[max_depth];
+        std::size_t slots[max_depth];
+        Leaf* leaf = find_leaf(key, path, slots);
+        std::size_t pos = count_keys_before<false>(leaf->keys, leaf->count, key);
+        if (pos < leaf->count && !(key < leaf->keys[pos])) return {iterator(this, leaf, pos), false};
+
+        if (leaf->count == leaf_capacity) {
+            // Split the leaf in half and link the new right sibling
+            std::size_t half = leaf_capacity / 2;
+            Leaf* right = new_leaf();
+            right->count = static_cast<std::uint16_t>(leaf_capacity - half);
+            std::move(leaf->keys + half, leaf->keys + leaf_capacity, right->keys);
+            std::move(leaf->values + half, leaf->values + leaf_capacity, right->values);
+            leaf->count = static_cast<std::uint16_t>(half);
+            right->next = leaf->next;
+            right->prev = leaf;
+            if (leaf->next) leaf->next->prev = right;
+            leaf->next = right;
+
+            insert_into_parent(path, slots, height, right->keys[0], right);
+            if (pos > half) {
+                leaf = right;
+                pos -= half;
+            }
+        }
+
+        std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        std::move_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+        leaf->keys[pos] = key;
+        leaf->values[pos] = value;
+        ++leaf->count;
+        ++element_count;
+        return {iterator(this, leaf, pos), true};
+    }
+
+    // Lazy erase: the key is removed from its leaf, the tree shape is unchanged
+    std::size_t erase(const Key& key) {
+        if (!root) return 0;
+        Leaf* leaf = find_leaf(key);
+        std::size_t pos = count_keys_before<false>(leaf->keys, leaf->count, key);
+        if (pos == leaf->count || key < leaf->keys[pos]) return 0;
+        std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+        std::move(leaf->values + pos + 1, leaf->values + leaf->count, leaf->values + pos);
+        --leaf->count;
+        --element_count;
+        return 1;
+    }
+
+    // Builds the tree bottom-up from (unsorted) pairs: full leaves, then each
+    // inner level from the first keys of the level below. Duplicate keys keep
+    // their first occurrence.
+    void bulk_load(std::vector<std::pair<Key, T>> items) {
+        clear();
+        std::stable_sort(items.begin(), items.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        items.erase(std::unique(items.begin(), items.end(),
+                                [](const auto& a, const auto& b) { return !(a.first < b.first) && !(b.first < a.first); }),
+                    items.end());
+        if (items.empty()) return;
+
+        std::vector<Node*> level;
+        std::vector<Key> first_keys;
+        Leaf* prev = nullptr;
+        for (std::size_t i = 0; i < items.size(); i += leaf_capacity) {
+            Leaf* leaf = new_leaf();
+            std::size_t n = std::min(leaf_capacity, items.size() - i);
+            for (std::size_t j = 0; j < n; ++j) {
+                leaf->keys[j] = std::move(items[i + j].first);
+                leaf->values[j] = std::move(items[i + j].second);
+            }
+            leaf->count = static_cast<std::uint16_t>(n);
+            leaf->prev = prev;
+            if (prev) prev->next = leaf;
+            else head = leaf;
+            prev = leaf;
+            level.push_back(leaf);
+            first_keys.push_back(leaf->keys[0]);
+        }
+        element_count = items.size();
+
+        while (level.size() > 1) {
+            std::vector<Node*> parents;
+            std::vector<Key> parent_keys;
+            for (std::size_t i = 0; i < level.size(); i += inner_capacity + 1) {
+                Inner* in = new_inner();
+                std::size_t n = std::min(inner_capacity + 1, level.size() - i);
+                for (std::size_t j = 0; j < n; ++j) {
+                    in->children[j] = level[i + j];
+                    if (j > 0) in->keys[j - 1] = first_keys[i + j];
+                }
+                in->count = static_cast<std::uint16_t>(n - 1);
+                parents.push_back(in);
+                parent_keys.push_back(first_keys[i]);
+            }
+            level = std::move(parents);
+            first_keys = std::move(parent_keys);
+            ++height;
+        }
+        root = level[0];
+    }
+
+    // Visits [lo, hi] by walking the linked leaves
+    template<typename F>
+    void for_each_in_range(const Key& lo, const Key& hi, F f) const {
+        if (!root) return;
+        Leaf* leaf = find_leaf(lo);
+        std::size_t i = count_keys_before<false>(leaf->keys, leaf->count, lo);
+        for (; leaf; leaf = leaf->next, i = 0) {
+            for (; i < leaf->count; ++i) {
+                if (hi < leaf->keys[i]) return;
+                f(leaf->keys[i], leaf->values[i]);
+            }
+        }
+    }
+};
+
+void demonstrate_btree_map() {
+    std::cout << "\n=== B+-TREE MAP ===\n";
+
+    // Small nodes so a handful of keys already builds several levels
+    btree_map<int, int, 64> tree;
+    std::cout << std::format("64-byte nodes: {} keys per leaf ({} B), {} per inner node ({} B)\n",
+                             tree.leaf_slots(), tree.leaf_bytes(), tree.inner_slots(), tree.inner_bytes());
+
+    for (int k : {50, 20, 80, 10, 30, 70, 90, 60, 40, 25, 35, 45, 55, 65, 75, 85})
+        tree.insert(k, k * 10);
+    std::cout << std::format("Inserted 16 keys: size={}, depth={}\n", tree.size(), tree.depth());
+
+    std::cout << "In order: ";
+    for (auto [k, v] : tree) std::cout << k << " ";
+    std::cout << "\n";
+
+    // The lower_bound..upper_bound scan from demonstrate_map_lookup, over linked leaves
+    std::cout << "Range [30, 60]: ";
+    for (auto it = tree.lower_bound(30); it != tree.upper_bound(60); ++it)
+        std::cout << it->first << "=" << it->second << " ";
+    std::cout << "\n";
+
+    tree.erase(40);
+    tree.erase(45);
+    std::cout << std::format("After erase(40), erase(45): contains(40)={}, at(55)={}\n",
+                             tree.contains(40), tree.at(55));
+    try {
+        tree.at(41);
+    } catch (const std::out_of_range& e) {
+        std::cout << "at(41) threw: " << e.what() << "\n";
+    }
+
+    // Bulk load packs leaves full and builds inner levels bottom-up
+    btree_map<std::uint64_t, std::uint64_t> big;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> items;
+    for (std::uint64_t i = 0; i < 100000; ++i) items.emplace_back(i * 3, i);
+    big.bulk_load(std::move(items));
+    std::uint64_t sum = 0;
+    big.for_each_in_range(300, 330, [&](std::uint64_t, std::uint64_t v) { sum += v; });
+    std::cout << std::format("bulk_load 100000 keys: depth={}, {:.1f} bytes/key, sum of values for keys in [300,330] = {}\n",
+                             big.depth(), static_cast<double>(big.memory_bytes()) / big.size(), sum);
+}
+
+// ============================================================================
+// BENCHMARK - std::map vs btree_map: build, point lookups, range scans
+// 1M keys by default; CPP26_BENCH_SCALE=10 gives the 10M-key comparison.
+// ============================================================================
+void demonstrate_btree_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== B+-TREE BENCHMARK ===\n";
+
+    using Key = std::uint64_t;
+    const std::size_t n = scaled(1'000'000);
+    const std::size_t lookups = scaled(1 << 20);
+    const std::size_t scans = scaled(100'000);
+    const std::size_t scan_length = 100;
+
+    SplitMix64 rng(42);
+    std::vector<std::pair<Key, Key>> items(n);
+    for (std::size_t i = 0; i < n; ++i) items[i] = {rng.next(), i};
+    std::vector<Key> probes(lookups);
+    for (auto& p : probes) p = items[rng.next() % n].first;
+
+    std::cout << std::format("{} keys, {} lookups, {} scans of {} keys:\n", n, lookups, scans, scan_length);
+
+    std::map<Key, Key> tree;
+    print_result("std::map insert", time_ms([&] {
+        for (const auto& [k, v] : items) tree.emplace(k, v);
+    }), n);
+
+    btree_map<Key, Key> inserted;
+    print_result("btree_map insert", time_ms([&] {
+        for (const auto& [k, v] : items) inserted.insert(k, v);
+    }), n);
+
+    btree_map<Key, Key> bulk;
+    print_result("btree_map bulk_load", time_ms([&] { bulk.bulk_load(items); }), n);
+
+    print_result("std::map find", best_of_ms(3, [&] {
+        Key sum = 0;
+        for (Key p : probes) sum += tree.find(p)->second;
+        do_not_optimize(sum);
+    }), lookups);
+    print_result("btree_map find", best_of_ms(3, [&] {
+        Key sum = 0;
+        for (Key p : probes) sum += bulk.find(p)->second;
+        do_not_optimize(sum);
+    }), lookups);
+
+    print_result("std::map lower_bound + 100 x ++", best_of_ms(3, [&] {
+        Key sum = 0;
+        for (std::size_t s = 0; s < scans; ++s) {
+            auto it = tree.lower_bound(probes[s % lookups]);
+            for (std::size_t i = 0; i < scan_length && it != tree.end(); ++i, ++it) sum += it->second;
+        }
+        do_not_optimize(sum);
+    }), scans * scan_length);
+    print_result("btree_map leaf-walk scan", best_of_ms(3, [&] {
+        Key sum = 0;
+        for (std::size_t s = 0; s < scans; ++s) {
+            auto it = bulk.lower_bound(probes[s % lookups]);
+            for (std::size_t i = 0; i < scan_length && it != bulk.end(); ++i, ++it) sum += (*it).second;
+        }
+        do_not_optimize(sum);
+    }), scans * scan_length);
+
+    std::cout << std::format("  memory: btree_map (bulk) {:.1f} B/key, (inserted) {:.1f} B/key; "
+                             "std::map node >= {} B/key before malloc overhead\n",
+                             static_cast<double>(bulk.memory_bytes()) / n,
+                             static_cast<double>(inserted.memory_bytes()) / n,
+                             4 * sizeof(void*) + sizeof(std::pair<const Key, Key>));
+}
+
+void run_all_demos() {
+    demonstrate_btree_map();
+    demonstrate_btree_benchmark();
+}
+
+} // namespace cpp26_btree
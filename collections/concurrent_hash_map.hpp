@@ -0,0 +1,552 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <optional>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+#include "hashing.hpp"
+
+namespace cpp26_concurrent_hash {
+
+// ============================================================================
+// CONCURRENT HASH MAP - Sharded open addressing with seqlock-validated reads
+// The top hash bits pick one of N shards, each on its own cache lines with
+// its own table, writer mutex and version counter. Writers lock only their
+// shard and bump the version to odd while they change slots, then back to
+// even. Readers take no lock: they read the version, probe the table, and
+// retry if the version was odd or changed meanwhile (a seqlock). Slots are
+// stored as relaxed atomic words, so a torn read is discarded rather than
+// being a data race; Key and T must therefore be trivially copyable.
+// A shard grows on its own: the new table is built beside the old one, which
+// readers keep using, then published with a single version bump. Replaced
+// tables are kept until the map is destroyed, so a reader never touches
+// freed memory; capacity only doubles, so they add up to less than the live
+// tables. A table clogged with tombstones is swept in place instead, with the
+// version held odd, so insert/erase churn at a steady size allocates nothing.
+// Reference: https://www.hpl.hp.com/techreports/2012/HPL-2012-68.pdf (seqlocks)
+// ============================================================================
+namespace detail {
+
+inline void cpu_relax(unsigned& spins) {
+    if (++spins < 64) {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+        _mm_pause();
+#endif
+    } else {
+        spins = 0;
+        std::this_thread::yield();  // The writer may have been preempted mid-update
+    }
+}
+
+// Trivially copyable value kept in relaxed atomic words so that reads racing
+// a writer are well defined; the seqlock decides whether to trust them
+template<typename V>
+class atomic_cell {
+private:
+    static constexpr std::size_t words = (sizeof(V) + 7) / 8;
+    std::array<std::atomic<std::uint64_t>, words> data{};
+
+public:
+    V load() const {
+        std::uint64_t buffer[words];
+        for (std::size_t i = 0; i < words; ++i) buffer[i] = data[i].load(std::memory_order_relaxed);
+        V value;
+        std::memcpy(&value, buffer, sizeof(V));
+        return value;
+    }
+
+    void store(const V& value) {
+        std::uint64_t buffer[words] = {};
+        std::memcpy(buffer, &value, sizeof(V));
+        for (std::size_t i = 0; i < words; ++i) data[i].store(buffer[i], std::memory_order_relaxed);
+    }
+};
+
+template<typename Hash>
+concept avalanching = requires { typename Hash::is_avalanching; };
+
+} // namespace detail
+
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class concurrent_hash_map {
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<T>,
+                  "concurrent_hash_map: optimistic reads need trivially copyable keys and values");
+
+private:
+    static constexpr std::uint8_t tag_empty = 0;
+    static constexpr std::uint8_t tag_deleted = 1;
+    static constexpr std::size_t min_capacity = 16;
+
+    struct Slot {
+        std::atomic<std::uint8_t> tag{tag_empty};  // Full slots: 0x80 | top 7 hash bits
+        detail::atomic_cell<Key> key;
+        detail::atomic_cell<T> value;
+    };
+
+    struct Table {
+        std::size_t mask;
+        std::unique_ptr<Slot[]> slots;
+
+        explicit Table(std::size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+    };
+
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> version{0};  // Odd while a writer is changing slots
+        std::atomic<const Table*> table{nullptr};
+        std::atomic<std::size_t> count{0};
+        std::mutex mutex;                       // Serializes writers
+        std::size_t used = 0;                   // Full + deleted slots, under mutex
+        std::vector<std::unique_ptr<Table>> tables;  // Current table last; older ones retired
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    std::size_t shard_mask;
+    [[no_unique_address]] Hash hasher;
+    [[no_unique_address]] KeyEqual equal;
+
+    std::uint64_t hash_of(const Key& key) const {
+        auto h = static_cast<std::uint64_t>(hasher(key));
+        // Shard and slot come from different bits, so they must not be
+        // correlated: one multiply left strided keys sharing a slot residue
+        // per shard. The full murmur3 finalizer keeps them independent.
+        if constexpr (!detail::avalanching<Hash>) h = cpp26_hash::mix_murmur3(h);
+        return h;
+    }
+
+    static std::uint8_t tag_of(std::uint64_t h) { return static_cast<std::uint8_t>(0x80 | (h >> 57)); }
+
+    Shard& shard_for(std::uint64_t h) const { return shards[(h >> 32) & shard_mask]; }
+
+    // Probe for key; returns the slot or nullptr. Safe on a table that a writer
+    // is changing: the probe is bounded and the caller validates the result.
+    Slot* lookup(const Table& table, const Key& key, std::uint64_t h) const {
+        std::uint8_t tag = tag_of(h);
+        std::size_t i = h & table.mask;
+        for (std::size_t n = 0; n <= table.mask; ++n, i = (i + 1) & table.mask) {
+            std::uint8_t t = table.slots[i].tag.load(std::memory_order_relaxed);
+            if (t == tag_empty) return nullptr;
+            if (t == tag && equal(table.slots[i].key.load(), key)) return &table.slots[i];
+        }
+        return nullptr;
+    }
+
+    // Seqlock read: f runs on a consistent snapshot of the shard, possibly several times
+    template<typename F>
+    auto read(const Key& key, F&& f) const {
+        std::uint64_t h = hash_of(key);
+        const Shard& shard = shard_for(h);
+        unsigned spins = 0;
+        for (;;) {
+            std::uint64_t before = shard.version.load(std::memory_order_acquire);
+            if (before & 1) {
+                detail::cpu_relax(spins);
+                continue;
+            }
+            const Table* table = shard.table.load(std::memory_order_acquire);
+            auto result = f(table ? lookup(*table, key, h) : nullptr);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.version.load(std::memory_order_relaxed) == before) return result;
+        }
+    }
+
+    static void begin_write(Shard& shard) {
+        shard.version.store(shard.version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    static void end_write(Shard& shard) {
+        shard.version.store(shard.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Copies the live entries into a fresh table while readers keep using the old one
+    void rehash(Shard& shard, std::size_t capacity) {
+        auto fresh = std::make_unique<Table>(capacity);
+        if (const Table* old = shard.table.load(std::memory_order_relaxed)) {
+            for (std::size_t i = 0; i <= old->mask; ++i) {
+                const Slot& slot = old->slots[i];
+                if (slot.tag.load(std::memory_order_relaxed) < 0x80) continue;
+                Key key = slot.key.load();
+                std::size_t j = hash_of(key) & fresh->mask;
+                while (fresh->slots[j].tag.load(std::memory_order_relaxed) != tag_empty) j = (j + 1) & fresh->mask;
+                fresh->slots[j].key.store(key);
+                fresh->slots[j].value.store(slot.value.load());
+                fresh->slots[j].tag.store(slot.tag.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+        begin_write(shard);
+        shard.table.store(fresh.get(), std::memory_order_relaxed);
+        end_write(shard);
+        shard.tables.push_back(std::move(fresh));
+        shard.used = shard.count.load(std::memory_order_relaxed);
+    }
+
+    // Drops tombstones without a new table: live entries are set aside, the
+    // slots cleared and refilled. Readers see an odd version throughout and
+    // retry, and any probe already under way is discarded by the version check.
+    void purge(Shard& shard, const Table& table) {
+        std::vector<std::pair<Key, T>> live;
+        live.reserve(shard.count.load(std::memory_order_relaxed));
+        for (std::size_t i = 0; i <= table.mask; ++i)
+            if (table.slots[i].tag.load(std::memory_order_relaxed) >= 0x80)
+                live.emplace_back(table.slots[i].key.load(), table.slots[i].value.load());
+        begin_write(shard);
+        for (std::size_t i = 0; i <= table.mask; ++i) table.slots[i].tag.store(tag_empty, std::memory_order_relaxed);
+        for (const auto& [key, value] : live) {
+            std::uint64_t h = hash_of(key);
+            std::size_t j = h & table.mask;
+            while (table.slots[j].tag.load(std::memory_order_relaxed) != tag_empty) j = (j + 1) & table.mask;
+            table.slots[j].key.store(key);
+            table.slots[j].value.store(value);
+            table.slots[j].tag.store(tag_of(h), std::memory_order_relaxed);
+        }
+        end_write(shard);
+        shard.used = live.size();
+    }
+
+    // Writer-side probe: the key's slot, or the slot a new key should take (max load 3/4)
+    std::pair<Slot*, bool> find_or_prepare(Shard& shard, const Key& key, std::uint64_t h) {
+        const Table* table = shard.table.load(std::memory_order_relaxed);
+        if (!table || (shard.used + 1) * 4 > (table->mask + 1) * 3) {
+            std::size_t live = shard.count.load(std::memory_order_relaxed) + 1;
+            std::size_t capacity = table ? table->mask + 1 : min_capacity;
+            while (live * 2 > capacity) capacity *= 2;
+            if (table && capacity == table->mask + 1) purge(shard, *table);  // Mostly tombstones
+            else rehash(shard, capacity);
+            table = shard.table.load(std::memory_order_relaxed);
+        }
+        std::uint8_t tag = tag_of(h);
+        Slot* free_slot = nullptr;
+        std::size_t i = h & table->mask;
+        for (;; i = (i + 1) & table->mask) {
+            Slot& slot = table->slots[i];
+            std::uint8_t t = slot.tag.load(std::memory_order_relaxed);
+            if (t == tag && equal(slot.key.load(), key)) return {&slot, true};
+            if (t == tag_deleted && !free_slot) free_slot = &slot;
+            if (t == tag_empty) return {free_slot ? free_slot : &slot, false};
+        }
+    }
+
+    // Fills a prepared slot; the caller brackets this with begin_write/end_write
+    void occupy(Shard& shard, Slot& slot, const Key& key, const T& value, std::uint64_t h) {
+        if (slot.tag.load(std::memory_order_relaxed) == tag_empty) ++shard.used;
+        slot.key.store(key);
+        slot.value.store(value);
+        slot.tag.store(tag_of(h), std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template<typename F>
+    auto write(const Key& key, F&& f) {
+        std::uint64_t h = hash_of(key);
+        Shard& shard = shard_for(h);
+        std::lock_guard lock(shard.mutex);
+        return f(shard, h);
+    }
+
+public:
+    explicit concurrent_hash_map(std::size_t shard_count = 64)
+        : shards(new Shard[std::bit_ceil(std::max<std::size_t>(shard_count, 1))]),
+          shard_mask(std::bit_ceil(std::max<std::size_t>(shard_count, 1)) - 1) {}
+
+    concurrent_hash_map(const concurrent_hash_map&) = delete;
+    concurrent_hash_map& operator=(const concurrent_hash_map&) = delete;
+
+    // Lock-free lookups
+    std::optional<T> find(const Key& key) const {
+        return read(key, [](const Slot* slot) -> std::optional<T> {
+            if (!slot) return std::nullopt;
+            return slot->value.load();
+        });
+    }
+
+    bool contains(const Key& key) const {
+        return read(key, [](const Slot* slot) { return slot != nullptr; });
+    }
+
+    // Inserts if absent; returns false (and leaves the value) if key exists
+    bool insert(const Key& key, const T& value) {
+        return write(key, [&](Shard& shard, std::uint64_t h) {
+            auto [slot, found] = find_or_prepare(shard, key, h);
+            if (found) return false;
+            begin_write(shard);
+            occupy(shard, *slot, key, value, h);
+            end_write(shard);
+            return true;
+        });
+    }
+
+    // Returns true if inserted, false if an existing value was replaced
+    bool insert_or_assign(const Key& key, const T& value) {
+        return write(key, [&](Shard& shard, std::uint64_t h) {
+            auto [slot, found] = find_or_prepare(shard, key, h);
+            begin_write(shard);
+            if (found) slot->value.store(value);
+            else occupy(shard, *slot, key, value, h);
+            end_write(shard);
+            return !found;
+        });
+    }
+
+    // Returns the value for key, calling make() to create it only if absent.
+    // make runs under the shard lock, so it runs at most once per key.
+    template<typename F>
+    T compute_if_absent(const Key& key, F make) {
+        if (auto existing = find(key)) return *existing;
+        return write(key, [&](Shard& shard, std::uint64_t h) {
+            auto [slot, found] = find_or_prepare(shard, key, h);
+            if (found) return slot->value.load();
+            T value = make();
+            begin_write(shard);
+            occupy(shard, *slot, key, value, h);
+            end_write(shard);
+            return value;
+        });
+    }
+
+    // Inserts value_if_absent, or applies update(T&) to the existing value;
+    // atomic per key. Returns the value now stored.
+    template<typename F>
+    T upsert(const Key& key, const T& value_if_absent, F update) {
+        return write(key, [&](Shard& shard, std::uint64_t h) {
+            auto [slot, found] = find_or_prepare(shard, key, h);
+            T value = value_if_absent;
+            if (found) {
+                value = slot->value.load();
+                update(value);
+            }
+            begin_write(shard);
+            if (found) slot->value.store(value);
+            else occupy(shard, *slot, key, value, h);
+            end_write(shard);
+            return value;
+        });
+    }
+
+    bool erase(const Key& key) {
+        return write(key, [&](Shard& shard, std::uint64_t h) {
+            const Table* table = shard.table.load(std::memory_order_relaxed);
+            Slot* slot = table ? lookup(*table, key, h) : nullptr;
+            if (!slot) return false;
+            begin_write(shard);
+            slot->tag.store(tag_deleted, std::memory_order_relaxed);
+            end_write(shard);
+            shard.count.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        });
+    }
+
+    // Grows every shard up front for about n entries in total
+    void reserve(std::size_t n) {
+        std::size_t per_shard = std::bit_ceil(std::max(min_capacity, 2 * (n / (shard_mask + 1) + 1)));
+        for (std::size_t s = 0; s <= shard_mask; ++s) {
+            std::lock_guard lock(shards[s].mutex);
+            const Table* table = shards[s].table.load(std::memory_order_relaxed);
+            if (!table || table->mask + 1 < per_shard) rehash(shards[s], per_shard);
+        }
+    }
+
+    // Approximate while writers are active
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t s = 0; s <= shard_mask; ++s) total += shards[s].count.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    bool empty() const { return size() == 0; }
+    std::size_t shard_count() const { return shard_mask + 1; }
+
+    // Visits each entry; locks one shard at a time, so the view is per-shard consistent
+    template<typename F>
+    void for_each(F&& f) const {
+        for (std::size_t s = 0; s <= shard_mask; ++s) {
+            std::lock_guard lock(shards[s].mutex);
+            const Table* table = shards[s].table.load(std::memory_order_relaxed);
+            if (!table) continue;
+            for (std::size_t i = 0; i <= table->mask; ++i)
+                if (table->slots[i].tag.load(std::memory_order_relaxed) >= 0x80)
+                    f(table->slots[i].key.load(), table->slots[i].value.load());
+        }
+    }
+
+    // Probe hooks for cpp26_hash_diagnostics. Slots are numbered across
+    // shards in order; with linear probing every slot is a possible home.
+    std::size_t bucket_count() const {
+        std::size_t slots = 0;
+        for (std::size_t s = 0; s <= shard_mask; ++s)
+            if (const Table* table = shards[s].table.load(std::memory_order_acquire)) slots += table->mask + 1;
+        return slots;
+    }
+    std::size_t home_count() const { return bucket_count(); }
+
+    // Calls f(key, slot, home, slots probed) for every entry, one shard locked
+    // at a time. Shards may grow between the calls, so positions are only
+    // meaningful against the returned slot count, not an earlier bucket_count().
+    template<typename F>
+    std::size_t for_each_probe(F&& f) const {
+        std::size_t base = 0;
+        for (std::size_t s = 0; s <= shard_mask; ++s) {
+            std::lock_guard lock(shards[s].mutex);
+            const Table* table = shards[s].table.load(std::memory_order_relaxed);
+            if (!table) continue;
+            for (std::size_t i = 0; i <= table->mask; ++i) {
+                if (table->slots[i].tag.load(std::memory_order_relaxed) < 0x80) continue;
+                Key key = table->slots[i].key.load();
+                std::size_t home = hash_of(key) & table->mask;
+                f(key, base + i, base + home, ((i - home) & table->mask) + 1);
+            }
+            base += table->mask + 1;
+        }
+        return base;
+    }
+
+    // Slots allocated across all shards, including retired tables
+    std::size_t memory_bytes() const {
+        std::size_t bytes = sizeof(*this) + (shard_mask + 1) * sizeof(Shard);
+        for (std::size_t s = 0; s <= shard_mask; ++s) {
+            std::lock_guard lock(shards[s].mutex);
+            for (const auto& table : shards[s].tables) bytes += sizeof(Table) + (table->mask + 1) * sizeof(Slot);
+        }
+        return bytes;
+    }
+};
+
+void demonstrate_concurrent_hash_map() {
+    std::cout << "\n=== CONCURRENT HASH MAP ===\n";
+
+    concurrent_hash_map<int, int> map(16);
+    std::cout << std::format("Shards: {}\n", map.shard_count());
+
+    // Four writers count hits on a shared key space with upsert
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&map] {
+            for (int i = 0; i < 10'000; ++i) map.upsert(i % 1000, 1, [](int& v) { ++v; });
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    bool all_40 = true;
+    map.for_each([&](int, int v) { all_40 = all_40 && v == 40; });
+    std::cout << std::format("After 4 threads x 10000 upserts over 1000 keys: size={}, every count == 40: {}\n",
+                             map.size(), all_40);
+
+    // compute_if_absent: many threads race for the same keys, each value is built once
+    std::atomic<int> builds{0};
+    threads.clear();
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int k = 5000; k < 5100; ++k) map.compute_if_absent(k, [&] { builds.fetch_add(1); return k * 2; });
+        });
+    }
+    for (auto& th : threads) th.join();
+    std::cout << std::format("compute_if_absent over 100 new keys from 4 threads: {} builds, find(5050)={}\n",
+                             builds.load(), map.find(5050).value_or(-1));
+
+    bool inserted = map.insert(7, 0);
+    bool assigned_new = map.insert_or_assign(7, 0);
+    std::cout << std::format("insert(7, 0) on existing key: {}, insert_or_assign(7, 0) inserted: {}, find(7)={}\n",
+                             inserted, assigned_new, map.find(7).value_or(-1));
+    bool erased = map.erase(7);
+    std::cout << std::format("erase(7): {}, contains(7): {}, size={}\n", erased, map.contains(7), map.size());
+    std::cout << std::format("Memory incl. retired tables: {} KB\n", map.memory_bytes() / 1024);
+}
+
+// ============================================================================
+// SCALING BENCHMARK - concurrent_hash_map vs std::unordered_map + locks
+// Fixed total work split across 1..64 threads over a half-full key space;
+// writes are half insert_or_assign, half erase
+// ============================================================================
+void demonstrate_concurrent_hash_map_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== CONCURRENT HASH MAP BENCHMARK ===\n";
+
+    const std::uint64_t key_space = 1 << 16;
+    const std::size_t total_ops = scaled(400'000);
+
+    struct LockedMap {
+        std::unordered_map<std::uint64_t, std::uint64_t> map;
+        mutable std::shared_mutex mutex;
+
+        bool contains(std::uint64_t k) const {
+            std::shared_lock lock(mutex);
+            return map.contains(k);
+        }
+        void insert_or_assign(std::uint64_t k, std::uint64_t v) {
+            std::unique_lock lock(mutex);
+            map.insert_or_assign(k, v);
+        }
+        void erase(std::uint64_t k) {
+            std::unique_lock lock(mutex);
+            map.erase(k);
+        }
+    };
+
+    auto run = [&](auto& target, int threads, unsigned write_percent) {
+        const std::size_t ops_per_thread = total_ops / static_cast<std::size_t>(threads);
+        return time_ms([&] {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&target, t, ops_per_thread, key_space, write_percent] {
+                    SplitMix64 rng(static_cast<std::uint64_t>(t) + 1);
+                    std::size_t hits = 0;
+                    for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                        std::uint64_t r = rng.next();
+                        std::uint64_t key = r % key_space;
+                        unsigned op = static_cast<unsigned>(r >> 56) % 100;
+                        if (op >= write_percent) hits += target.contains(key);
+                        else if (op & 1) target.erase(key);
+                        else target.insert_or_assign(key, r);
+                    }
+                    do_not_optimize(hits);
+                });
+            }
+            for (auto& w : workers) w.join();
+        });
+    };
+
+    std::cout << std::format("hardware threads: {}, {} ops per run\n", std::thread::hardware_concurrency(), total_ops);
+    for (unsigned write_percent : {10u, 50u}) {
+        std::cout << std::format("{}% reads / {}% writes:\n", 100 - write_percent, write_percent);
+        for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+            concurrent_hash_map<std::uint64_t, std::uint64_t> sharded;
+            LockedMap locked;
+            for (std::uint64_t k = 0; k < key_space; k += 2) {
+                sharded.insert(k, k);
+                locked.map.emplace(k, k);
+            }
+            print_result(std::format("unordered_map + shared_mutex, {} thr", threads),
+                         run(locked, threads, write_percent), total_ops);
+            print_result(std::format("concurrent_hash_map, {} thr", threads),
+                         run(sharded, threads, write_percent), total_ops);
+        }
+    }
+}
+
+void run_all_demos() {
+    demonstrate_concurrent_hash_map();
+    demonstrate_concurrent_hash_map_benchmark();
+}
+
+} // namespace cpp26_concurrent_hash
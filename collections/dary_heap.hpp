@@ -0,0 +1,420 @@
+#pragma once
+
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <string>
+#include <ranges>
+#include <functional>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_dary_heap {
+
+// ============================================================================
+// INDEXED D-ARY HEAP - Priority queue with decrease-key and erase by handle
+// A D-ary heap stores node i's children at D*i+1 .. D*i+D, so the tree is
+// log_D(n) levels deep: push and decrease_key climb fewer levels than in a
+// binary heap, and pop compares D adjacent children (one or two cache lines)
+// per level. D = 4 is usually the sweet spot.
+// Every element gets a handle at push; a position table maps handles to heap
+// slots and is updated on every move. That makes decrease_key, increase_key
+// and erase O(log_D n) instead of the lazy-deletion workaround for
+// std::priority_queue (push a duplicate, skip stale entries on pop).
+// Unlike std::priority_queue this is a min-heap with respect to Compare:
+// top() is the smallest element, and decrease_key moves an element towards
+// the top, as Dijkstra expects.
+// Reference: Johnson (1975), "Priority queues with update and finding
+// minimum spanning trees"; https://en.wikipedia.org/wiki/D-ary_heap
+// ============================================================================
+template<typename T, std::size_t D = 4, typename Compare = std::less<T>>
+class indexed_dary_heap {
+    static_assert(D >= 2, "indexed_dary_heap: arity must be at least 2");
+
+public:
+    using handle = std::size_t;
+    static constexpr handle npos = std::numeric_limits<handle>::max();
+
+private:
+    struct entry {
+        T value;
+        handle id;
+    };
+
+    std::vector<entry> heap;
+    std::vector<std::size_t> pos;   // Handle -> heap index, npos when the handle is free
+    std::vector<handle> free_ids;
+    [[no_unique_address]] Compare comp;
+
+    static constexpr std::size_t parent(std::size_t i) { return (i - 1) / D; }
+
+    void place(std::size_t i, entry&& e) {
+        pos[e.id] = i;
+        heap[i] = std::move(e);
+    }
+
+    // The sifts move a hole instead of swapping: one write per level.
+    // Each takes (by value, so it may come from the hole itself) the entry
+    // that belongs in the hole at i.
+    void sift_up(std::size_t i, entry e) {
+        while (i > 0) {
+            std::size_t p = parent(i);
+            if (!comp(e.value, heap[p].value)) break;
+            place(i, std::move(heap[p]));
+            i = p;
+        }
+        place(i, std::move(e));
+    }
+
+    // Smallest child of i, or npos for a leaf
+    std::size_t best_child(std::size_t i) const {
+        const std::size_t n = heap.size();
+        std::size_t first = D * i + 1;
+        if (first >= n) return npos;
+        std::size_t last = std::min(first + D, n);
+        std::size_t best = first;
+        for (std::size_t c = first + 1; c < last; ++c)
+            if (comp(heap[c].value, heap[best].value)) best = c;
+        return best;
+    }
+
+    void sift_down(std::size_t i, entry e) {
+        for (std::size_t c; (c = best_child(i)) != npos && comp(heap[c].value, e.value); i = c)
+            place(i, std::move(heap[c]));
+        place(i, std::move(e));
+    }
+
+    // After pop the refill comes from the bottom and nearly always sinks back
+    // there, so walk the hole down to a leaf without comparing against it,
+    // then let it climb the few levels it needs (Floyd; as std::pop_heap)
+    void sift_down_to_leaf(entry e) {
+        std::size_t i = 0;
+        for (std::size_t c; (c = best_child(i)) != npos; i = c) place(i, std::move(heap[c]));
+        sift_up(i, std::move(e));
+    }
+
+    std::size_t position(handle h) const {
+        if (h >= pos.size() || pos[h] == npos) throw std::out_of_range("indexed_dary_heap: invalid handle");
+        return pos[h];
+    }
+
+    handle acquire_id() {
+        if (!free_ids.empty()) {
+            handle h = free_ids.back();
+            free_ids.pop_back();
+            return h;
+        }
+        pos.push_back(npos);
+        return pos.size() - 1;
+    }
+
+    // Removes the entry at heap index i and fills the hole with the last one
+    void remove_at(std::size_t i) {
+        handle h = heap[i].id;
+        pos[h] = npos;
+        free_ids.push_back(h);
+        entry last = std::move(heap.back());
+        heap.pop_back();
+        if (i == heap.size()) return;
+        if (i == 0) sift_down_to_leaf(std::move(last));
+        else if (comp(last.value, heap[parent(i)].value)) sift_up(i, std::move(last));
+        else sift_down(i, std::move(last));
+    }
+
+public:
+    static constexpr std::size_t arity = D;
+
+    indexed_dary_heap() = default;
+    explicit indexed_dary_heap(const Compare& c) : comp(c) {}
+
+    template<std::ranges::input_range R>
+    explicit indexed_dary_heap(R&& values, const Compare& c = Compare()) : comp(c) {
+        assign(std::forward<R>(values));
+    }
+
+    // Bulk heapify in O(n) (Floyd): element i of the range gets handle i
+    template<std::ranges::input_range R>
+    void assign(R&& values) {
+        clear();
+        for (auto&& v : values) {
+            pos.push_back(heap.size());
+            heap.push_back({T(std::forward<decltype(v)>(v)), heap.size()});
+        }
+        if (heap.size() > 1)
+            for (std::size_t i = parent(heap.size() - 1) + 1; i-- > 0;) sift_down(i, std::move(heap[i]));
+    }
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+
+    const T& top() const { return heap.front().value; }
+    handle top_handle() const { return heap.front().id; }
+
+    // The handle stays valid until its element is popped or erased; it may
+    // then be reused by a later push
+    handle push(T value) {
+        handle h = acquire_id();
+        heap.push_back({std::move(value), h});
+        sift_up(heap.size() - 1, std::move(heap.back()));
+        return h;
+    }
+
+    void pop() { remove_at(0); }
+
+    void erase(handle h) { remove_at(position(h)); }
+
+    bool contains(handle h) const { return h < pos.size() && pos[h] != npos; }
+    const T& operator[](handle h) const { return heap[position(h)].value; }
+
+    // Moves h towards the top; value must not compare greater than the current one
+    void decrease_key(handle h, T value) {
+        std::size_t i = position(h);
+        if (comp(heap[i].value, value)) throw std::invalid_argument("indexed_dary_heap::decrease_key: key would increase");
+        sift_up(i, {std::move(value), h});
+    }
+
+    // Moves h away from the top; value must not compare less than the current one
+    void increase_key(handle h, T value) {
+        std::size_t i = position(h);
+        if (comp(value, heap[i].value)) throw std::invalid_argument("indexed_dary_heap::increase_key: key would decrease");
+        sift_down(i, {std::move(value), h});
+    }
+
+    // Either direction
+    void update(handle h, T value) {
+        std::size_t i = position(h);
+        if (comp(value, heap[i].value)) sift_up(i, {std::move(value), h});
+        else sift_down(i, {std::move(value), h});
+    }
+
+    void clear() {
+        heap.clear();
+        pos.clear();
+        free_ids.clear();
+    }
+
+    void reserve(std::size_t n) {
+        heap.reserve(n);
+        pos.reserve(n);
+    }
+};
+
+// ============================================================================
+// EXAMPLE - A timer queue: reschedule and cancel without stale entries
+// ============================================================================
+struct timer {
+    std::uint64_t deadline;
+    std::string name;
+
+    bool operator<(const timer& other) const { return deadline < other.deadline; }
+};
+
+void demonstrate_dary_heap() {
+    std::cout << "\n=== INDEXED D-ARY HEAP ===\n";
+
+    indexed_dary_heap<timer> timers;
+    auto heartbeat = timers.push({500, "heartbeat"});
+    auto flush = timers.push({200, "flush log"});
+    auto retry = timers.push({900, "retry request"});
+    auto gc = timers.push({300, "compact cache"});
+    timers.push({700, "rotate keys"});
+
+    std::cout << std::format("size={}, top=\"{}\" at t={} (arity {})\n", timers.size(), timers.top().name,
+                             timers.top().deadline, timers.arity);
+
+    timers.decrease_key(retry, {100, "retry request"});  // Server asked us to retry sooner
+    timers.increase_key(flush, {800, "flush log"});      // Batch more writes first
+    timers.erase(gc);                                     // Cancelled
+    timers.update(heartbeat, {450, "heartbeat"});
+
+    std::cout << std::format("After reschedule/cancel: contains(compact cache)={}, heartbeat at t={}\n",
+                             timers.contains(gc), timers[heartbeat].deadline);
+    std::cout << "Firing order:";
+    while (!timers.empty()) {
+        std::cout << std::format(" {}@{}", timers.top().name, timers.top().deadline);
+        timers.pop();
+    }
+    std::cout << "\n";
+
+    try {
+        timers.erase(gc);
+    } catch (const std::out_of_range& e) {
+        std::cout << std::format("erase(stale handle): {}\n", e.what());
+    }
+
+    // Bulk heapify: handle i is element i
+    std::vector<int> values = {42, 7, 19, 3, 88, 25, 11};
+    indexed_dary_heap<int, 2, std::greater<int>> max_heap(values);
+    max_heap.decrease_key(1, 99);  // "decrease" is towards the top: 7 -> 99 under greater<>
+    std::cout << "Heapified (binary max-heap), 7 promoted to 99:";
+    while (!max_heap.empty()) {
+        std::cout << ' ' << max_heap.top();
+        max_heap.pop();
+    }
+    std::cout << "\n";
+}
+
+// ============================================================================
+// BENCHMARK - Dijkstra: decrease_key vs std::priority_queue lazy deletion
+// The lazy version pushes a new (distance, vertex) pair on every
+// improvement and skips stale pairs when they surface, so the heap holds
+// up to one entry per relaxed edge instead of one per vertex.
+// ============================================================================
+using cpp26_benchmark::graph;
+using cpp26_benchmark::unreachable;
+
+struct dijkstra_stats {
+    std::size_t pushes = 0;
+    std::size_t updates = 0;     // decrease_key calls, or stale pops for lazy deletion
+    std::size_t peak_size = 0;
+};
+
+inline std::vector<std::uint64_t> dijkstra_lazy(const graph& g, std::uint32_t source, dijkstra_stats& stats) {
+    using item = std::pair<std::uint64_t, std::uint32_t>;
+    std::vector<std::uint64_t> dist(g.vertices(), unreachable);
+    std::priority_queue<item, std::vector<item>, std::greater<item>> pq;
+    dist[source] = 0;
+    pq.push({0, source});
+    while (!pq.empty()) {
+        stats.peak_size = std::max(stats.peak_size, pq.size());
+        auto [d, v] = pq.top();
+        pq.pop();
+        if (d != dist[v]) {
+            ++stats.updates;
+            continue;
+        }
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint64_t nd = d + g.weights[e];
+            std::uint32_t t = g.targets[e];
+            if (nd < dist[t]) {
+                dist[t] = nd;
+                pq.push({nd, t});
+                ++stats.pushes;
+            }
+        }
+    }
+    return dist;
+}
+
+template<std::size_t D>
+std::vector<std::uint64_t> dijkstra_indexed(const graph& g, std::uint32_t source, dijkstra_stats& stats) {
+    using heap_type = indexed_dary_heap<std::pair<std::uint64_t, std::uint32_t>, D>;
+    std::vector<std::uint64_t> dist(g.vertices(), unreachable);
+    std::vector<typename heap_type::handle> where(g.vertices(), heap_type::npos);
+    heap_type heap;
+    dist[source] = 0;
+    where[source] = heap.push({0, source});
+    while (!heap.empty()) {
+        stats.peak_size = std::max(stats.peak_size, heap.size());
+        auto [d, v] = heap.top();
+        heap.pop();
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint64_t nd = d + g.weights[e];
+            std::uint32_t t = g.targets[e];
+            if (nd >= dist[t]) continue;
+            // A vertex with a finite distance that is no longer queued is settled,
+            // and settled vertices never improve, so this is either new or queued
+            if (dist[t] == unreachable) {
+                where[t] = heap.push({nd, t});
+                ++stats.pushes;
+            } else {
+                heap.decrease_key(where[t], {nd, t});
+                ++stats.updates;
+            }
+            dist[t] = nd;
+        }
+    }
+    return dist;
+}
+
+void demonstrate_dary_heap_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== D-ARY HEAP BENCHMARK ===\n";
+
+    // Push n random keys, then pop them all
+    const std::size_t n = scaled(1'000'000);
+    SplitMix64 rng(73);
+    std::vector<std::uint64_t> keys(n);
+    for (auto& k : keys) k = rng.next();
+
+    std::cout << std::format("{} random uint64 keys, push all then pop all:\n", n);
+    std::uint64_t sink = 0;
+    print_result("std::priority_queue (binary)", best_of_ms(3, [&] {
+        std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>> pq;
+        for (auto k : keys) pq.push(k);
+        while (!pq.empty()) {
+            sink += pq.top();
+            pq.pop();
+        }
+    }), 2 * n);
+    auto run_heap = [&]<std::size_t D>(const char* label) {
+        print_result(label, best_of_ms(3, [&] {
+            indexed_dary_heap<std::uint64_t, D> heap;
+            heap.reserve(n);
+            for (auto k : keys) heap.push(k);
+            while (!heap.empty()) {
+                sink += heap.top();
+                heap.pop();
+            }
+        }), 2 * n);
+    };
+    run_heap.template operator()<2>("indexed_dary_heap<D=2>");
+    run_heap.template operator()<4>("indexed_dary_heap<D=4>");
+    run_heap.template operator()<8>("indexed_dary_heap<D=8>");
+    std::cout << "  (the indexed heaps also keep every handle's position up to date)\n";
+
+    print_result("std::make_heap of n keys", best_of_ms(3, [&] {
+        std::vector<std::uint64_t> copy = keys;
+        std::make_heap(copy.begin(), copy.end(), std::greater<>());
+        sink += copy.front();
+    }), n);
+    print_result("indexed_dary_heap<D=4> bulk heapify", best_of_ms(3, [&] {
+        indexed_dary_heap<std::uint64_t, 4> heap(keys);
+        sink += heap.top();
+    }), n);
+    do_not_optimize(sink);
+
+    // Dijkstra on a random sparse graph
+    const std::size_t vertices = scaled(200'000);
+    const std::size_t degree = 8;
+    graph g = random_graph(vertices, degree, 2024);
+    std::cout << std::format("Dijkstra, {} vertices, {} edges:\n", vertices, vertices * degree);
+
+    dijkstra_stats lazy_stats;
+    std::vector<std::uint64_t> expected;
+    double lazy_ms = best_of_ms(3, [&] {
+        lazy_stats = {};
+        expected = dijkstra_lazy(g, 0, lazy_stats);
+    });
+    std::cout << std::format("  {:<36} {:>8.2f} ms  pushes {:>8}  stale pops {:>8}  peak heap {:>8}\n",
+                             "std::priority_queue + lazy deletion", lazy_ms, lazy_stats.pushes, lazy_stats.updates,
+                             lazy_stats.peak_size);
+
+    auto run_dijkstra = [&]<std::size_t D>(const char* label) {
+        dijkstra_stats stats;
+        std::vector<std::uint64_t> dist;
+        double ms = best_of_ms(3, [&] {
+            stats = {};
+            dist = dijkstra_indexed<D>(g, 0, stats);
+        });
+        std::cout << std::format("  {:<36} {:>8.2f} ms  pushes {:>8}  decreases  {:>8}  peak heap {:>8}{}\n", label, ms,
+                                 stats.pushes, stats.updates, stats.peak_size, dist == expected ? "" : "  MISMATCH");
+    };
+    run_dijkstra.template operator()<2>("indexed_dary_heap<D=2>");
+    run_dijkstra.template operator()<4>("indexed_dary_heap<D=4>");
+    run_dijkstra.template operator()<8>("indexed_dary_heap<D=8>");
+}
+
+void run_all_demos() {
+    demonstrate_dary_heap();
+    demonstrate_dary_heap_benchmark();
+}
+
+} // namespace cpp26_dary_heap
@@ -0,0 +1,962 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_set>
+#include <map>
+#include <vector>
+#include <string>
+#include <span>
+#include <array>
+#include <optional>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+#include "hashing.hpp"
+
+namespace cpp26_filters {
+
+// ============================================================================
+// MEMBERSHIP FILTERS - Compact "definitely not / maybe" answers for keys
+// A filter stores a few bits per key and answers contains() with no false
+// negatives and a tunable false-positive rate. Put one in front of a
+// container whose lookups mostly miss: a miss is then usually rejected
+// by one cache-line read instead of a full hash probe or tree walk.
+//   - bloom_filter: k bits anywhere in the array (classic baseline)
+//   - blocked_bloom_filter: all bits of a key in one 32-byte block, tested
+//     with one AVX2 compare (split block Bloom filter)
+//   - cuckoo_filter: fingerprints in 4-slot buckets, supports erase
+//   - binary_fuse_filter: static, built once from a key set; about 1.13x
+//     the information-theoretic minimum space
+// Each takes a target false-positive rate, builds from a span of keys,
+// answers batches, and round-trips through serialize(); the blocked,
+// cuckoo and fuse filters prefetch a batch ahead of probing it.
+// Keys go through Hash (std::hash by default) and a 64-bit finalizer.
+// Reference: https://arxiv.org/abs/2201.01174 (binary fuse filters)
+//            https://www.cs.cmu.edu/~dga/papers/cuckoo-conext2014.pdf
+// ============================================================================
+namespace detail {
+
+// std::hash is the identity for integers, so every key goes through the
+// MurmurHash3 finalizer from hashing.hpp
+using cpp26_hash::mix_murmur3;
+
+// High 64 bits of a * b: maps a uniform hash onto [0, b) without division
+inline std::uint64_t mul_high(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<__uint128_t>(a) * b) >> 64);
+#else
+    std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+    std::uint64_t mid = (la * lb >> 32) + static_cast<std::uint32_t>(ha * lb) + static_cast<std::uint32_t>(la * hb);
+    return ha * hb + (ha * lb >> 32) + (la * hb >> 32) + (mid >> 32);
+#endif
+}
+
+inline void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+// Little-endian byte stream used by every serialize()/deserialize()
+struct writer {
+    std::vector<std::uint8_t> out;
+
+    void put32(std::uint32_t v) {
+        for (int b = 0; b < 4; ++b) out.push_back(static_cast<std::uint8_t>(v >> (8 * b)));
+    }
+    void put64(std::uint64_t v) {
+        put32(static_cast<std::uint32_t>(v));
+        put32(static_cast<std::uint32_t>(v >> 32));
+    }
+};
+
+struct reader {
+    std::span<const std::uint8_t> bytes;
+    std::size_t pos = 0;
+
+    void need(std::size_t n) const {
+        if (bytes.size() - pos < n) throw std::runtime_error("filter: truncated input");
+    }
+    std::uint32_t get32() {
+        need(4);
+        std::uint32_t v = 0;
+        for (int b = 0; b < 4; ++b) v |= std::uint32_t{bytes[pos + b]} << (8 * b);
+        pos += 4;
+        return v;
+    }
+    std::uint64_t get64() {
+        std::uint64_t lo = get32();
+        return lo | std::uint64_t{get32()} << 32;
+    }
+    void expect(std::uint32_t magic) {
+        if (get32() != magic) throw std::runtime_error("filter: bad magic");
+    }
+    void finish() const {
+        if (pos != bytes.size()) throw std::runtime_error("filter: trailing bytes");
+    }
+};
+
+// Fixed-width fields of 1..57 bits packed back to back in 64-bit words
+class packed_array {
+private:
+    std::vector<std::uint64_t> words;  // One spare word so get() can always read two
+    std::size_t count = 0;
+    unsigned bits = 0;
+    std::uint64_t mask = 0;
+
+public:
+    packed_array() = default;
+    packed_array(std::size_t n, unsigned width)
+        : words((n * width + 63) / 64 + 1, 0), count(n), bits(width),
+          mask(width == 64 ? ~0ull : (std::uint64_t{1} << width) - 1) {}
+
+    std::uint64_t get(std::size_t i) const {
+        std::size_t bit = i * bits;
+        std::size_t w = bit / 64, off = bit % 64;
+        // (x << 1) << (63 - off) is x << (64 - off) without the undefined shift by 64
+        return ((words[w] >> off) | ((words[w + 1] << 1) << (63 - off))) & mask;
+    }
+
+    void set(std::size_t i, std::uint64_t v) {
+        std::size_t bit = i * bits;
+        std::size_t w = bit / 64, off = bit % 64;
+        v &= mask;
+        words[w] = (words[w] & ~(mask << off)) | (v << off);
+        if (off + bits > 64) {
+            std::size_t spill = 64 - off;
+            words[w + 1] = (words[w + 1] & ~(mask >> spill)) | (v >> spill);
+        }
+    }
+
+    const void* address(std::size_t i) const { return words.data() + i * bits / 64; }
+    std::size_t size() const { return count; }
+    unsigned width() const { return bits; }
+    std::size_t memory_bytes() const { return words.size() * sizeof(std::uint64_t); }
+
+    void write(writer& out) const {
+        out.put64(count);
+        out.put32(bits);
+        for (auto w : words) out.put64(w);
+    }
+
+    static packed_array read(reader& in, unsigned min_bits, unsigned max_bits) {
+        std::uint64_t n = in.get64();
+        unsigned width = in.get32();
+        if (width < min_bits || width > max_bits) throw std::runtime_error("filter: bad field width");
+        if (n > (in.bytes.size() - in.pos) * 8 / width) throw std::runtime_error("filter: truncated input");
+        packed_array a(n, width);
+        in.need(a.words.size() * 8);
+        for (auto& w : a.words) w = in.get64();
+        return a;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// BLOOM FILTER - k probes spread over the whole bit array (baseline)
+// Bits per key m/n = -ln(p) / ln(2)^2 and k = (m/n) ln 2 minimize space,
+// but every probe is a likely cache miss. Probes use double hashing.
+// ============================================================================
+template<typename Key = std::uint64_t, typename Hash = std::hash<Key>>
+class bloom_filter {
+private:
+    static constexpr std::uint32_t magic = 0x31464c42;  // "BLF1"
+
+    std::vector<std::uint64_t> words;
+    std::uint64_t bit_count = 0;
+    unsigned k = 1;
+    [[no_unique_address]] Hash hasher;
+
+    std::uint64_t hash_of(const Key& key) const { return detail::mix_murmur3(static_cast<std::uint64_t>(hasher(key))); }
+
+    template<typename F>
+    void for_each_probe(std::uint64_t h, F&& f) const {
+        std::uint64_t step = std::rotl(h, 32) | 1, x = h;  // Steps must move the high bits
+        for (unsigned i = 0; i < k; ++i, x += step) f(detail::mul_high(x, bit_count));
+    }
+
+    bloom_filter() = default;
+
+public:
+    bloom_filter(std::size_t expected_keys, double false_positive_rate) {
+        if (!(false_positive_rate > 0 && false_positive_rate < 1))
+            throw std::invalid_argument("bloom_filter: false-positive rate must be in (0, 1)");
+        double bits_per_key = -std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0));
+        k = std::clamp(static_cast<unsigned>(std::lround(bits_per_key * std::log(2.0))), 1u, 30u);
+        bit_count = std::max<std::uint64_t>(64, static_cast<std::uint64_t>(bits_per_key * static_cast<double>(expected_keys)));
+        words.assign((bit_count + 63) / 64, 0);
+    }
+
+    bloom_filter(std::span<const Key> keys, double false_positive_rate)
+        : bloom_filter(keys.size(), false_positive_rate) {
+        insert(keys);
+    }
+
+    void insert(const Key& key) {
+        for_each_probe(hash_of(key), [&](std::uint64_t bit) { words[bit / 64] |= std::uint64_t{1} << (bit % 64); });
+    }
+
+    void insert(std::span<const Key> keys) {
+        for (const auto& key : keys) insert(key);
+    }
+
+    bool contains(const Key& key) const {
+        bool all = true;
+        for_each_probe(hash_of(key), [&](std::uint64_t bit) { all &= (words[bit / 64] >> (bit % 64)) & 1; });
+        return all;
+    }
+
+    // out[i] = contains(keys[i]); returns the number of positives. No
+    // prefetch: a key's k bits are spread over k lines, not one.
+    std::size_t contains_batch(std::span<const Key> keys, std::span<std::uint8_t> out) const {
+        if (out.size() < keys.size()) throw std::invalid_argument("output span is smaller than keys");
+        std::size_t positives = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i) positives += out[i] = contains(keys[i]);
+        return positives;
+    }
+
+    unsigned hash_count() const { return k; }
+    std::size_t memory_bytes() const { return words.size() * sizeof(std::uint64_t); }
+
+    std::vector<std::uint8_t> serialize() const {
+        detail::writer out;
+        out.put32(magic);
+        out.put64(bit_count);
+        out.put32(k);
+        for (auto w : words) out.put64(w);
+        return std::move(out.out);
+    }
+
+    static bloom_filter deserialize(std::span<const std::uint8_t> bytes) {
+        detail::reader in{bytes};
+        in.expect(magic);
+        bloom_filter f;
+        f.bit_count = in.get64();
+        f.k = in.get32();
+        if (f.bit_count == 0 || f.k == 0 || f.k > 30) throw std::runtime_error("bloom_filter: bad header");
+        // Checked before sizing: a huge bit_count would wrap the word count
+        if (f.bit_count > (bytes.size() - in.pos) * 8) throw std::runtime_error("filter: truncated input");
+        std::size_t n = static_cast<std::size_t>((f.bit_count + 63) / 64);
+        in.need(n * 8);
+        f.words.resize(n);
+        for (auto& w : f.words) w = in.get64();
+        in.finish();
+        return f;
+    }
+};
+
+// ============================================================================
+// BLOCKED BLOOM FILTER - Split block Bloom filter (as in Parquet and Impala)
+// A key selects one 256-bit block and sets one bit in each of its eight
+// 32-bit words, the bit chosen by multiplying the hash by a per-word odd
+// constant. Insert and test are one AVX2 multiply, shift and OR/test over
+// the block, and a lookup touches a single cache line. It needs somewhat
+// more bits per key than a classic filter for the same rate; the size is
+// found by evaluating the exact rate of this layout.
+// Reference: https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+// ============================================================================
+template<typename Key = std::uint64_t, typename Hash = std::hash<Key>>
+class blocked_bloom_filter {
+private:
+    static constexpr std::uint32_t magic = 0x31464242;  // "BBF1"
+
+    struct alignas(32) Block {
+        std::uint32_t words[8];
+    };
+
+    static constexpr std::uint32_t salt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    std::vector<Block> blocks;
+    [[no_unique_address]] Hash hasher;
+
+    std::uint64_t hash_of(const Key& key) const { return detail::mix_murmur3(static_cast<std::uint64_t>(hasher(key))); }
+
+    const Block& block_for(std::uint64_t h) const { return blocks[detail::mul_high(h, blocks.size())]; }
+    Block& block_for(std::uint64_t h) { return blocks[detail::mul_high(h, blocks.size())]; }
+
+#if defined(__AVX2__)
+    static __m256i make_mask(std::uint32_t h) {
+        __m256i products = _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(h)),
+                                              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salt)));
+        return _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(products, 27));
+    }
+#endif
+
+    static void set_bits(Block& block, std::uint32_t h) {
+#if defined(__AVX2__)
+        auto* p = reinterpret_cast<__m256i*>(block.words);
+        _mm256_store_si256(p, _mm256_or_si256(_mm256_load_si256(p), make_mask(h)));
+#else
+        for (int i = 0; i < 8; ++i) block.words[i] |= std::uint32_t{1} << ((h * salt[i]) >> 27);
+#endif
+    }
+
+    static bool test_bits(const Block& block, std::uint32_t h) {
+#if defined(__AVX2__)
+        // testc: every mask bit is also set in the block
+        return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(block.words)), make_mask(h));
+#else
+        std::uint32_t missing = 0;
+        for (int i = 0; i < 8; ++i) missing |= ~block.words[i] & (std::uint32_t{1} << ((h * salt[i]) >> 27));
+        return missing == 0;
+#endif
+    }
+
+    // Exact false-positive rate of this layout at the given bits per key:
+    // block loads are Poisson, and a block holding j keys has each word bit set
+    // with probability 1 - (31/32)^j
+    static double rate_at(double bits_per_key) {
+        double lambda = 256.0 / bits_per_key;
+        double term = std::exp(-lambda), rate = 0;
+        for (int j = 0; j < 2000; ++j) {
+            if (j > 0) term *= lambda / j;
+            rate += term * std::pow(1.0 - std::pow(31.0 / 32.0, j), 8);
+            if (j > lambda && term < 1e-18) break;
+        }
+        return rate;
+    }
+
+    blocked_bloom_filter() = default;
+
+public:
+    blocked_bloom_filter(std::size_t expected_keys, double false_positive_rate) {
+        if (!(false_positive_rate > 0 && false_positive_rate < 1))
+            throw std::invalid_argument("blocked_bloom_filter: false-positive rate must be in (0, 1)");
+        double bits_per_key = 2;
+        while (bits_per_key < 64 && rate_at(bits_per_key) > false_positive_rate) bits_per_key += 0.25;
+        double total_bits = bits_per_key * static_cast<double>(expected_keys);
+        blocks.assign(std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(total_bits / 256))), Block{});
+    }
+
+    blocked_bloom_filter(std::span<const Key> keys, double false_positive_rate)
+        : blocked_bloom_filter(keys.size(), false_positive_rate) {
+        insert(keys);
+    }
+
+    void insert(const Key& key) {
+        std::uint64_t h = hash_of(key);
+        set_bits(block_for(h), static_cast<std::uint32_t>(h));
+    }
+
+    void insert(std::span<const Key> keys) {
+        for (const auto& key : keys) insert(key);
+    }
+
+    bool contains(const Key& key) const {
+        std::uint64_t h = hash_of(key);
+        return test_bits(block_for(h), static_cast<std::uint32_t>(h));
+    }
+
+    // Hashes and prefetches a group of keys before testing, so up to
+    // Group block reads are in flight at once
+    template<std::size_t Group = 16>
+    std::size_t contains_batch(std::span<const Key> keys, std::span<std::uint8_t> out) const {
+        if (out.size() < keys.size()) throw std::invalid_argument("output span is smaller than keys");
+        std::size_t positives = 0;
+        for (std::size_t base = 0; base < keys.size(); base += Group) {
+            std::size_t n = std::min(Group, keys.size() - base);
+            std::uint64_t h[Group];
+            for (std::size_t g = 0; g < n; ++g) {
+                h[g] = hash_of(keys[base + g]);
+                detail::prefetch(&block_for(h[g]));
+            }
+            for (std::size_t g = 0; g < n; ++g)
+                positives += out[base + g] = test_bits(block_for(h[g]), static_cast<std::uint32_t>(h[g]));
+        }
+        return positives;
+    }
+
+    // Combines two filters built with the same size
+    blocked_bloom_filter& operator|=(const blocked_bloom_filter& other) {
+        if (other.blocks.size() != blocks.size()) throw std::invalid_argument("blocked_bloom_filter: size mismatch");
+        for (std::size_t b = 0; b < blocks.size(); ++b)
+            for (int i = 0; i < 8; ++i) blocks[b].words[i] |= other.blocks[b].words[i];
+        return *this;
+    }
+
+    static double expected_rate(double bits_per_key) { return rate_at(bits_per_key); }
+    std::size_t memory_bytes() const { return blocks.size() * sizeof(Block); }
+
+    std::vector<std::uint8_t> serialize() const {
+        detail::writer out;
+        out.put32(magic);
+        out.put64(blocks.size());
+        for (const auto& b : blocks)
+            for (auto w : b.words) out.put32(w);
+        return std::move(out.out);
+    }
+
+    static blocked_bloom_filter deserialize(std::span<const std::uint8_t> bytes) {
+        detail::reader in{bytes};
+        in.expect(magic);
+        std::uint64_t n = in.get64();
+        if (n == 0 || n > (bytes.size() - in.pos) / sizeof(Block)) throw std::runtime_error("blocked_bloom_filter: bad size");
+        blocked_bloom_filter f;
+        f.blocks.resize(n);
+        for (auto& b : f.blocks)
+            for (auto& w : b.words) w = in.get32();
+        in.finish();
+        return f;
+    }
+};
+
+// ============================================================================
+// CUCKOO FILTER - f-bit fingerprints in buckets of four, with erase
+// A key's fingerprint may live in bucket i1 = hash or i2 = (hash(fp) - i1)
+// mod n, so either bucket can be computed from the other without the key,
+// for any bucket count n (no power-of-two rounding of the table). Insert
+// evicts a random resident to its alternate bucket when both are full.
+// A bucket is one 4f-bit word (f <= 16), so "does it hold fp?" and "is a
+// slot free?" are single SWAR zero-lane tests. Rate ~ 8 / 2^f at full load.
+// Reference: https://github.com/efficient/cuckoofilter
+// ============================================================================
+template<typename Key = std::uint64_t, typename Hash = std::hash<Key>>
+class cuckoo_filter {
+private:
+    static constexpr std::uint32_t magic = 0x31464b43;  // "CKF1"
+    static constexpr unsigned slots = 4;
+    static constexpr int max_kicks = 500;
+    static constexpr std::size_t min_buckets = 16;  // Small tables have no slack at 94% load
+
+    detail::packed_array buckets;  // 4 * f bits per bucket
+    std::size_t bucket_count = 1;
+    unsigned f = 8;
+    std::uint64_t lane_ones = 0, lane_high = 0, fp_mask = 0;
+    std::size_t count = 0;
+    // A fingerprint left homeless by a failed insert; the filter is then full
+    bool has_victim = false;
+    std::uint64_t victim_fp = 0;
+    std::size_t victim_bucket = 0;
+    std::uint64_t rng = 0x9E3779B97F4A7C15ull;
+    [[no_unique_address]] Hash hasher;
+
+    void set_width(unsigned bits) {
+        f = bits;
+        fp_mask = (std::uint64_t{1} << f) - 1;
+        lane_ones = 0;
+        for (unsigned s = 0; s < slots; ++s) lane_ones |= std::uint64_t{1} << (s * f);
+        lane_high = lane_ones << (f - 1);
+    }
+
+    // Nonzero fingerprint (zero marks an empty slot) and primary bucket
+    std::pair<std::uint64_t, std::size_t> locate(const Key& key) const {
+        std::uint64_t h = detail::mix_murmur3(static_cast<std::uint64_t>(hasher(key)));
+        return {static_cast<std::uint32_t>(h) % fp_mask + 1, detail::mul_high(h, bucket_count)};
+    }
+
+    std::size_t alternate(std::size_t bucket, std::uint64_t fp) const {
+        std::size_t t = detail::mul_high(detail::mix_murmur3(fp), bucket_count);
+        return t >= bucket ? t - bucket : t + bucket_count - bucket;
+    }
+
+    // Lanes of `bucket` equal to zero; exact for "any", the lowest set lane is a true match
+    std::uint64_t zero_lanes(std::uint64_t bucket) const {
+        return (bucket - lane_ones) & ~bucket & lane_high;
+    }
+
+    bool bucket_has(std::size_t b, std::uint64_t fp) const {
+        return zero_lanes(buckets.get(b) ^ (fp * lane_ones)) != 0;
+    }
+
+    bool try_place(std::size_t b, std::uint64_t fp) {
+        std::uint64_t word = buckets.get(b);
+        std::uint64_t empty = zero_lanes(word);
+        if (!empty) return false;
+        unsigned lane = static_cast<unsigned>(std::countr_zero(empty)) / f;
+        buckets.set(b, word | (fp << (lane * f)));
+        return true;
+    }
+
+    bool remove_from(std::size_t b, std::uint64_t fp) {
+        std::uint64_t word = buckets.get(b);
+        std::uint64_t match = zero_lanes(word ^ (fp * lane_ones));
+        if (!match) return false;
+        unsigned lane = static_cast<unsigned>(std::countr_zero(match)) / f;
+        buckets.set(b, word & ~(fp_mask << (lane * f)));
+        return true;
+    }
+
+    // Empties the filter and gives it n buckets
+    void reset(std::size_t n) {
+        bucket_count = n;
+        buckets = detail::packed_array(bucket_count, slots * f);
+        count = 0;
+        has_victim = false;
+    }
+
+    cuckoo_filter() = default;
+
+public:
+    // Fingerprint bits come from the rate and are clamped to 4..16
+    cuckoo_filter(std::size_t expected_keys, double false_positive_rate) {
+        if (!(false_positive_rate > 0 && false_positive_rate < 1))
+            throw std::invalid_argument("cuckoo_filter: false-positive rate must be in (0, 1)");
+        auto bits = static_cast<unsigned>(std::ceil(std::log2(2.0 * slots / false_positive_rate)));
+        set_width(std::clamp(bits, 4u, 16u));
+        // Sized for 94% load; 4-way buckets fill reliably to about 95%
+        reset(std::max(min_buckets, (expected_keys * 50 / 47 + slots - 1) / slots));
+    }
+
+    // A build that does not fit is retried with 1/16 more buckets; throws
+    // only when that keeps failing (more than 8 copies of one key)
+    cuckoo_filter(std::span<const Key> keys, double false_positive_rate)
+        : cuckoo_filter(keys.size(), false_positive_rate) {
+        for (int attempt = 0;; ++attempt) {
+            bool fits = true;
+            for (const auto& key : keys)
+                if (!(fits = insert(key))) break;
+            if (fits) return;
+            if (attempt == 8) throw std::runtime_error("cuckoo_filter: table full during build");
+            reset(bucket_count + bucket_count / 16 + 1);
+        }
+    }
+
+    // Returns false once the filter is full. The insert that fills it still
+    // keeps every key (one fingerprint waits in the victim slot); after that,
+    // a false return means the key was not stored.
+    bool insert(const Key& key) {
+        if (has_victim) return false;
+        auto [fp, i1] = locate(key);
+        std::size_t i2 = alternate(i1, fp);
+        if (try_place(i1, fp) || try_place(i2, fp)) {
+            ++count;
+            return true;
+        }
+        // Kick a random resident out of one of the two buckets and follow the chain
+        std::size_t b = (rng & 1) ? i1 : i2;
+        for (int kick = 0; kick < max_kicks; ++kick) {
+            rng = rng * 6364136223846793005ull + 1442695040888963407ull;
+            unsigned lane = static_cast<unsigned>(rng >> 62);
+            std::uint64_t word = buckets.get(b);
+            std::uint64_t evicted = (word >> (lane * f)) & fp_mask;
+            buckets.set(b, (word & ~(fp_mask << (lane * f))) | (fp << (lane * f)));
+            fp = evicted;
+            b = alternate(b, fp);
+            if (try_place(b, fp)) {
+                ++count;
+                return true;
+            }
+        }
+        has_victim = true;
+        victim_fp = fp;
+        victim_bucket = b;
+        ++count;
+        return false;
+    }
+
+    bool contains(const Key& key) const {
+        auto [fp, i1] = locate(key);
+        std::size_t i2 = alternate(i1, fp);
+        return bucket_has(i1, fp) || bucket_has(i2, fp) ||
+               (has_victim && victim_fp == fp && (victim_bucket == i1 || victim_bucket == i2));
+    }
+
+    // Removes one copy of key's fingerprint; only erase keys that were inserted
+    bool erase(const Key& key) {
+        auto [fp, i1] = locate(key);
+        std::size_t i2 = alternate(i1, fp);
+        if (has_victim && victim_fp == fp && (victim_bucket == i1 || victim_bucket == i2)) {
+            has_victim = false;
+        } else if (!remove_from(i1, fp) && !remove_from(i2, fp)) {
+            return false;
+        }
+        --count;
+        // Freed a slot: give the victim another chance
+        if (has_victim) {
+            has_victim = false;
+            std::uint64_t vfp = victim_fp;
+            std::size_t vb = victim_bucket;
+            if (!try_place(vb, vfp) && !try_place(alternate(vb, vfp), vfp)) has_victim = true;
+        }
+        return true;
+    }
+
+    template<std::size_t Group = 16>
+    std::size_t contains_batch(std::span<const Key> keys, std::span<std::uint8_t> out) const {
+        if (out.size() < keys.size()) throw std::invalid_argument("output span is smaller than keys");
+        std::size_t positives = 0;
+        for (std::size_t base = 0; base < keys.size(); base += Group) {
+            std::size_t n = std::min(Group, keys.size() - base);
+            std::uint64_t fp[Group];
+            std::size_t b1[Group], b2[Group];
+            for (std::size_t g = 0; g < n; ++g) {
+                std::tie(fp[g], b1[g]) = locate(keys[base + g]);
+                b2[g] = alternate(b1[g], fp[g]);
+                detail::prefetch(buckets.address(b1[g]));
+                detail::prefetch(buckets.address(b2[g]));
+            }
+            for (std::size_t g = 0; g < n; ++g) {
+                bool hit = bucket_has(b1[g], fp[g]) || bucket_has(b2[g], fp[g]) ||
+                           (has_victim && victim_fp == fp[g] && (victim_bucket == b1[g] || victim_bucket == b2[g]));
+                positives += out[base + g] = hit;
+            }
+        }
+        return positives;
+    }
+
+    std::size_t size() const { return count; }
+    double load_factor() const { return static_cast<double>(count) / static_cast<double>(buckets.size() * slots); }
+    unsigned fingerprint_bits() const { return f; }
+    std::size_t memory_bytes() const { return buckets.memory_bytes(); }
+
+    std::vector<std::uint8_t> serialize() const {
+        detail::writer out;
+        out.put32(magic);
+        out.put64(count);
+        out.put32(has_victim);
+        out.put64(victim_fp);
+        out.put64(victim_bucket);
+        buckets.write(out);
+        return std::move(out.out);
+    }
+
+    static cuckoo_filter deserialize(std::span<const std::uint8_t> bytes) {
+        detail::reader in{bytes};
+        in.expect(magic);
+        cuckoo_filter c;
+        c.count = in.get64();
+        c.has_victim = in.get32() != 0;
+        c.victim_fp = in.get64();
+        c.victim_bucket = in.get64();
+        c.buckets = detail::packed_array::read(in, slots * 4, slots * 16);
+        in.finish();
+        if (c.buckets.width() % slots || c.buckets.size() == 0 || c.victim_bucket >= c.buckets.size())
+            throw std::runtime_error("cuckoo_filter: bad table shape");
+        c.set_width(c.buckets.width() / slots);
+        c.bucket_count = c.buckets.size();
+        return c;
+    }
+};
+
+// ============================================================================
+// BINARY FUSE FILTER - Static xor filter with windowed 3-wise hashing
+// Each key maps to three slots in consecutive segments, and its f-bit
+// fingerprint equals the XOR of those three slots. Construction "peels"
+// slots that only one remaining key maps to, then assigns values in reverse
+// peel order. Lookup is three loads and two XORs; space is ~1.13 f bits
+// per key for large sets, rate ~ 2^-f. Keys must be known up front.
+// ============================================================================
+template<typename Key = std::uint64_t, typename Hash = std::hash<Key>>
+class binary_fuse_filter {
+private:
+    static constexpr std::uint32_t magic = 0x31464642;  // "BFF1"
+    static constexpr int max_attempts = 100;
+
+    std::uint64_t seed = 0;
+    std::uint32_t segment_length = 0;
+    std::uint32_t segment_length_mask = 0;
+    std::uint32_t segment_count_length = 0;
+    detail::packed_array fingerprints;
+    std::uint64_t fp_mask = 0;
+    [[no_unique_address]] Hash hasher;
+
+    std::uint64_t key_hash(const Key& key) const { return detail::mix_murmur3(static_cast<std::uint64_t>(hasher(key))); }
+
+    std::uint64_t seeded(std::uint64_t k) const { return detail::mix_murmur3(k + seed); }
+
+    std::uint64_t fingerprint(std::uint64_t h) const { return (h ^ (h >> 32)) & fp_mask; }
+
+    std::array<std::uint32_t, 3> positions(std::uint64_t h) const {
+        auto h0 = static_cast<std::uint32_t>(detail::mul_high(h, segment_count_length));
+        std::uint32_t h1 = h0 + segment_length, h2 = h1 + segment_length;
+        h1 ^= static_cast<std::uint32_t>(h >> 18) & segment_length_mask;
+        h2 ^= static_cast<std::uint32_t>(h) & segment_length_mask;
+        return {h0, h1, h2};
+    }
+
+    void size_for(std::size_t n) {
+        // Segment length and slack from the paper's empirical fit for arity 3
+        segment_length = n <= 1 ? 4 : std::min<std::uint32_t>(
+            std::uint32_t{1} << static_cast<int>(std::floor(std::log(static_cast<double>(n)) / std::log(3.33) + 2.25)),
+            262144);
+        segment_length_mask = segment_length - 1;
+        double size_factor = n <= 1 ? 0 : std::max(1.125, 0.875 + 0.25 * std::log(1e6) / std::log(static_cast<double>(n)));
+        auto capacity = static_cast<std::size_t>(std::round(static_cast<double>(n) * size_factor));
+        std::size_t segment_count = (capacity + segment_length - 1) / segment_length;
+        segment_count = segment_count <= 2 ? 1 : segment_count - 2;
+        segment_count_length = static_cast<std::uint32_t>(segment_count * segment_length);
+    }
+
+    // hashes: seeded, sorted and unique, so the slot updates below walk the array in order
+    bool try_build(std::span<const std::uint64_t> hashes, std::size_t array_length) {
+        const std::size_t n = hashes.size();
+        std::vector<std::uint8_t> t2count(array_length, 0);  // (keys << 2) | xor of their positions
+        std::vector<std::uint64_t> t2hash(array_length, 0);  // xor of their hashes
+        for (auto h : hashes) {
+            auto p = positions(h);
+            for (std::uint8_t j = 0; j < 3; ++j) {
+                t2count[p[j]] += 4;
+                t2count[p[j]] ^= j;
+                t2hash[p[j]] ^= h;
+                if (t2count[p[j]] < 4) return false;  // More than 63 keys on one slot
+            }
+        }
+
+        std::vector<std::uint32_t> queue;
+        for (std::uint32_t i = 0; i < array_length; ++i)
+            if ((t2count[i] >> 2) == 1) queue.push_back(i);
+
+        std::vector<std::uint64_t> stack_hash;
+        std::vector<std::uint8_t> stack_pos;
+        stack_hash.reserve(n);
+        stack_pos.reserve(n);
+        while (!queue.empty()) {
+            std::uint32_t index = queue.back();
+            queue.pop_back();
+            if ((t2count[index] >> 2) != 1) continue;
+            std::uint64_t h = t2hash[index];
+            std::uint8_t found = t2count[index] & 3;
+            stack_hash.push_back(h);
+            stack_pos.push_back(found);
+            auto p = positions(h);
+            for (std::uint8_t j = 0; j < 3; ++j) {
+                if (j == found) continue;
+                std::uint32_t other = p[j];
+                t2count[other] -= 4;
+                t2count[other] ^= j;
+                t2hash[other] ^= h;
+                if ((t2count[other] >> 2) == 1) queue.push_back(other);
+            }
+            t2count[index] = 0;
+        }
+        if (stack_hash.size() != n) return false;
+
+        // Reverse peel order: each key's free slot is set last, fixing its XOR
+        for (std::size_t i = n; i-- > 0;) {
+            auto p = positions(stack_hash[i]);
+            std::uint8_t found = stack_pos[i];
+            std::uint64_t value = fingerprint(stack_hash[i]);
+            for (std::uint8_t j = 0; j < 3; ++j)
+                if (j != found) value ^= fingerprints.get(p[j]);
+            fingerprints.set(p[found], value);
+        }
+        return true;
+    }
+
+    binary_fuse_filter() = default;
+
+public:
+    // Fingerprint bits = ceil(log2(1 / rate)), clamped to 1..32.
+    // Duplicate keys are allowed; throws only if every seed fails.
+    binary_fuse_filter(std::span<const Key> keys, double false_positive_rate) {
+        if (!(false_positive_rate > 0 && false_positive_rate < 1))
+            throw std::invalid_argument("binary_fuse_filter: false-positive rate must be in (0, 1)");
+        auto bits = std::clamp(static_cast<unsigned>(std::ceil(-std::log2(false_positive_rate))), 1u, 32u);
+        fp_mask = (std::uint64_t{1} << bits) - 1;
+
+        std::vector<std::uint64_t> base(keys.size()), hashes;
+        for (std::size_t i = 0; i < keys.size(); ++i) base[i] = key_hash(keys[i]);
+
+        size_for(keys.size());
+        std::size_t array_length = segment_count_length + 2 * std::size_t{segment_length};
+        std::uint64_t seed_state = 0x726f6f74ull;
+        for (int attempt = 0; attempt < max_attempts; ++attempt) {
+            seed = detail::mix_murmur3(seed_state += 0x9E3779B97F4A7C15ull);
+            // The first slot grows with the seeded hash, so sorted hashes touch memory in order;
+            // seeding is a bijection, so duplicates stay adjacent and unique() drops them
+            hashes.resize(base.size());
+            std::ranges::transform(base, hashes.begin(), [&](std::uint64_t k) { return seeded(k); });
+            std::ranges::sort(hashes);
+            hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+            fingerprints = detail::packed_array(array_length, bits);
+            if (try_build(hashes, array_length)) return;
+        }
+        throw std::runtime_error("binary_fuse_filter: construction failed");
+    }
+
+    bool contains(const Key& key) const {
+        std::uint64_t h = seeded(key_hash(key));
+        auto p = positions(h);
+        return (fingerprint(h) ^ fingerprints.get(p[0]) ^ fingerprints.get(p[1]) ^ fingerprints.get(p[2])) == 0;
+    }
+
+    template<std::size_t Group = 16>
+    std::size_t contains_batch(std::span<const Key> keys, std::span<std::uint8_t> out) const {
+        if (out.size() < keys.size()) throw std::invalid_argument("output span is smaller than keys");
+        std::size_t positives = 0;
+        for (std::size_t base = 0; base < keys.size(); base += Group) {
+            std::size_t n = std::min(Group, keys.size() - base);
+            std::uint64_t h[Group];
+            std::array<std::uint32_t, 3> p[Group];
+            for (std::size_t g = 0; g < n; ++g) {
+                h[g] = seeded(key_hash(keys[base + g]));
+                p[g] = positions(h[g]);
+                for (auto slot : p[g]) detail::prefetch(fingerprints.address(slot));
+            }
+            for (std::size_t g = 0; g < n; ++g) {
+                bool hit = (fingerprint(h[g]) ^ fingerprints.get(p[g][0]) ^ fingerprints.get(p[g][1]) ^
+                            fingerprints.get(p[g][2])) == 0;
+                positives += out[base + g] = hit;
+            }
+        }
+        return positives;
+    }
+
+    unsigned fingerprint_bits() const { return fingerprints.width(); }
+    std::size_t memory_bytes() const { return fingerprints.memory_bytes(); }
+
+    std::vector<std::uint8_t> serialize() const {
+        detail::writer out;
+        out.put32(magic);
+        out.put64(seed);
+        out.put32(segment_length);
+        out.put32(segment_count_length);
+        fingerprints.write(out);
+        return std::move(out.out);
+    }
+
+    static binary_fuse_filter deserialize(std::span<const std::uint8_t> bytes) {
+        detail::reader in{bytes};
+        in.expect(magic);
+        binary_fuse_filter f;
+        f.seed = in.get64();
+        f.segment_length = in.get32();
+        f.segment_count_length = in.get32();
+        f.fingerprints = detail::packed_array::read(in, 1, 32);
+        in.finish();
+        // The builder always makes at least one segment; positions() relies on it
+        if (!std::has_single_bit(f.segment_length) || f.segment_count_length < f.segment_length ||
+            f.segment_count_length % f.segment_length ||
+            f.fingerprints.size() != f.segment_count_length + 2 * std::size_t{f.segment_length})
+            throw std::runtime_error("binary_fuse_filter: bad table shape");
+        f.segment_length_mask = f.segment_length - 1;
+        f.fp_mask = (std::uint64_t{1} << f.fingerprints.width()) - 1;
+        return f;
+    }
+};
+
+void demonstrate_filters() {
+    std::cout << "\n=== MEMBERSHIP FILTERS ===\n";
+
+    std::vector<std::string> words = {"apple", "banana", "cherry", "date", "elderberry", "fig", "grape"};
+    std::vector<std::string> probes = {"apple", "grape", "kiwi", "lemon", "mango"};
+
+    blocked_bloom_filter<std::string> bloom(std::span<const std::string>(words), 0.01);
+    cuckoo_filter<std::string> cuckoo(std::span<const std::string>(words), 0.01);
+    binary_fuse_filter<std::string> fuse(std::span<const std::string>(words), 0.01);
+
+    for (const auto& p : probes) {
+        std::cout << std::format("  {:<6} blocked bloom={} cuckoo={} binary fuse={}\n",
+                                 p, bloom.contains(p), cuckoo.contains(p), fuse.contains(p));
+    }
+
+    cuckoo.erase("banana");
+    std::cout << std::format("cuckoo after erase(banana): contains={}, size={}, {}-bit fingerprints\n",
+                             cuckoo.contains("banana"), cuckoo.size(), cuckoo.fingerprint_bits());
+
+    auto bytes = fuse.serialize();
+    auto restored = binary_fuse_filter<std::string>::deserialize(bytes);
+    std::cout << std::format("binary fuse serialized to {} bytes; restored contains(fig)={}\n",
+                             bytes.size(), restored.contains("fig"));
+
+    std::cout << "Blocked Bloom bits/key needed for a target rate:\n";
+    for (double target : {0.05, 0.01, 0.001}) {
+        double bits = 2;
+        while (blocked_bloom_filter<>::expected_rate(bits) > target) bits += 0.25;
+        std::cout << std::format("  {:<6} -> {:.2f} bits/key (classic Bloom: {:.2f})\n", target, bits,
+                                 -std::log(target) / (std::log(2.0) * std::log(2.0)));
+    }
+}
+
+// ============================================================================
+// BENCHMARK - Build time, lookup speed, space and measured false-positive rate,
+// then a filter in front of std::unordered_set and std::map for mostly-miss lookups
+// ============================================================================
+void demonstrate_filters_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== MEMBERSHIP FILTER BENCHMARK ===\n";
+
+    const std::size_t n = scaled(1'000'000);
+    const double target = 0.01;
+    SplitMix64 rng(2024);
+    std::vector<std::uint64_t> keys(n), misses(n);
+    for (auto& k : keys) k = rng.next();
+    for (auto& k : misses) k = rng.next();
+    std::vector<std::uint8_t> out(n);
+
+    std::cout << std::format("{} keys, target rate {}:\n", n, target);
+    std::cout << std::format("  {:<22} {:>9} {:>9} {:>10} {:>10} {:>10} {:>9}\n",
+                             "filter", "build ms", "bits/key", "hit ns", "miss ns", "batch ns", "FP rate");
+
+    auto report = [&](const char* label, auto&& build) {
+        std::optional<std::remove_cvref_t<decltype(build())>> filter;
+        double build_ms = time_ms([&] { filter.emplace(build()); });
+        std::size_t sum = 0;
+        double hit_ms = best_of_ms(3, [&] {
+            for (auto k : keys) sum += filter->contains(k);
+        });
+        double miss_ms = best_of_ms(3, [&] {
+            for (auto k : misses) sum += filter->contains(k);
+        });
+        std::size_t false_positives = 0;
+        double batch_ms = best_of_ms(3, [&] { false_positives = filter->contains_batch(std::span<const std::uint64_t>(misses), out); });
+        do_not_optimize(sum);
+        std::cout << std::format("  {:<22} {:>9.1f} {:>9.2f} {:>10.1f} {:>10.1f} {:>10.1f} {:>9.4f}\n", label, build_ms,
+                                 8.0 * static_cast<double>(filter->memory_bytes()) / static_cast<double>(n),
+                                 hit_ms * 1e6 / n, miss_ms * 1e6 / n, batch_ms * 1e6 / n,
+                                 static_cast<double>(false_positives) / static_cast<double>(n));
+    };
+    std::span<const std::uint64_t> key_span(keys);
+    report("bloom_filter", [&] { return bloom_filter<>(key_span, target); });
+    report("blocked_bloom_filter", [&] { return blocked_bloom_filter<>(key_span, target); });
+    report("cuckoo_filter", [&] { return cuckoo_filter<>(key_span, target); });
+    report("binary_fuse_filter", [&] { return binary_fuse_filter<>(key_span, target); });
+    report("binary_fuse (0.1%)", [&] { return binary_fuse_filter<>(key_span, 0.001); });
+
+    // 95% of lookups miss: the filter answers most of them from one cache line
+    std::vector<std::uint64_t> mixed(n);
+    for (std::size_t i = 0; i < n; ++i) mixed[i] = (i % 20 == 0) ? keys[(i * 7919) % n] : misses[i];
+    blocked_bloom_filter<> guard(key_span, target);
+
+    std::unordered_set<std::uint64_t> set(keys.begin(), keys.end());
+    std::size_t found = 0;
+    double plain_set = best_of_ms(3, [&] {
+        for (auto k : mixed) found += set.contains(k);
+    });
+    double guarded_set = best_of_ms(3, [&] {
+        for (auto k : mixed) found += guard.contains(k) && set.contains(k);
+    });
+
+    const std::size_t tree_n = std::min<std::size_t>(n, scaled(200'000));
+    std::map<std::uint64_t, std::uint64_t> tree;
+    for (std::size_t i = 0; i < tree_n; ++i) tree.emplace(keys[i], i);
+    blocked_bloom_filter<> tree_guard(key_span.first(tree_n), target);
+    double plain_tree = best_of_ms(3, [&] {
+        for (auto k : mixed) found += tree.contains(k);
+    });
+    double guarded_tree = best_of_ms(3, [&] {
+        for (auto k : mixed) found += tree_guard.contains(k) && tree.contains(k);
+    });
+    do_not_optimize(found);
+
+    std::cout << "Lookups where 95% miss:\n";
+    print_result("std::unordered_set", plain_set, n);
+    print_result("blocked_bloom + std::unordered_set", guarded_set, n);
+    print_result(std::format("std::map ({} keys)", tree_n), plain_tree, n);
+    print_result("blocked_bloom + std::map", guarded_tree, n);
+}
+
+void run_all_demos() {
+    demonstrate_filters();
+    demonstrate_filters_benchmark();
+}
+
+} // namespace cpp26_filters
@@ -0,0 +1,472 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_flat {
+
+// ============================================================================
+// SEARCH POLICIES - How the sorted key array is searched
+// branchless_search halves the range with a conditional move instead of a
+// branch, so there is nothing for the predictor to get wrong on random keys.
+// Reference: https://en.cppreference.com/w/cpp/algorithm/lower_bound
+// ============================================================================
+struct std_search {
+    template<typename It, typename K, typename Compare>
+    static It lower_bound(It first, It last, const K& key, const Compare& comp) {
+        return std::lower_bound(first, last, key, comp);
+    }
+};
+
+struct branchless_search {
+    template<typename It, typename K, typename Compare>
+    static It lower_bound(It first, It last, const K& key, const Compare& comp) {
+        auto n = last - first;
+        if (n == 0) return first;
+        while (n > 1) {
+            auto half = n / 2;
+            first = comp(first[half], key) ? first + half : first;
+            n -= half;
+        }
+        return first + comp(*first, key);
+    }
+};
+
+// Tag for constructors whose input is already sorted and free of duplicates
+struct sorted_unique_t { explicit sorted_unique_t() = default; };
+inline constexpr sorted_unique_t sorted_unique{};
+
+// ============================================================================
+// FLAT_SET - Sorted std::vector with set semantics (std::flat_set, C++23)
+// Reference: https://en.cppreference.com/w/cpp/container/flat_set
+// ============================================================================
+template<typename Key, typename Compare = std::less<Key>, typename Search = branchless_search>
+class flat_set {
+private:
+    std::vector<Key> sorted_keys;
+    Compare comp;
+
+    template<typename K>
+    static constexpr bool lookup_ok = std::is_same_v<K, Key> || requires { typename Compare::is_transparent; };
+
+    bool equivalent(const Key& a, const Key& b) const { return !comp(a, b) && !comp(b, a); }
+
+    // Sorts [first_new, end) and merges it into the sorted prefix, keeping existing keys
+    void merge_tail(std::size_t first_new) {
+        auto mid = sorted_keys.begin() + static_cast<std::ptrdiff_t>(first_new);
+        std::stable_sort(mid, sorted_keys.end(), comp);
+        std::inplace_merge(sorted_keys.begin(), mid, sorted_keys.end(), comp);
+        auto last = std::unique(sorted_keys.begin(), sorted_keys.end(),
+                                [&](const Key& a, const Key& b) { return equivalent(a, b); });
+        sorted_keys.erase(last, sorted_keys.end());
+    }
+
+public:
+    using iterator = typename std::vector<Key>::const_iterator;
+
+    flat_set() = default;
+
+    // Bulk build: O(n log n) sort + unique instead of n tree insertions
+    explicit flat_set(std::vector<Key> keys, const Compare& c = Compare())
+        : sorted_keys(std::move(keys)), comp(c) {
+        merge_tail(0);
+    }
+
+    flat_set(sorted_unique_t, std::vector<Key> keys, const Compare& c = Compare())
+        : sorted_keys(std::move(keys)), comp(c) {}
+
+    flat_set(std::initializer_list<Key> init) : flat_set(std::vector<Key>(init)) {}
+
+    iterator begin() const { return sorted_keys.begin(); }
+    iterator end() const { return sorted_keys.end(); }
+    std::size_t size() const { return sorted_keys.size(); }
+    bool empty() const { return sorted_keys.empty(); }
+    void reserve(std::size_t n) { sorted_keys.reserve(n); }
+    std::span<const Key> keys() const { return sorted_keys; }
+
+    template<typename K> requires lookup_ok<K>
+    iterator lower_bound(const K& key) const {
+        return Search::lower_bound(sorted_keys.begin(), sorted_keys.end(), key, comp);
+    }
+    iterator lower_bound(const Key& key) const { return lower_bound<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    iterator upper_bound(const K& key) const {
+        return std::upper_bound(sorted_keys.begin(), sorted_keys.end(), key, comp);
+    }
+    iterator upper_bound(const Key& key) const { return upper_bound<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    iterator find(const K& key) const {
+        auto it = lower_bound(key);
+        return (it != end() && !comp(key, *it)) ? it : end();
+    }
+    iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    bool contains(const K& key) const { return find(key) != end(); }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    // Single insert is O(n) because of the shift; prefer insert_range for batches
+    std::pair<iterator, bool> insert(const Key& key) {
+        auto it = lower_bound(key);
+        if (it != end() && !comp(key, *it)) return {it, false};
+        return {sorted_keys.insert(it, key), true};
+    }
+
+    // Batched insert: append, sort the batch, one linear merge
+    template<std::ranges::input_range R>
+    void insert_range(R&& range) {
+        std::size_t first_new = sorted_keys.size();
+        sorted_keys.insert(sorted_keys.end(), std::ranges::begin(range), std::ranges::end(range));
+        merge_tail(first_new);
+    }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t erase(const K& key) {
+        auto it = find(key);
+        if (it == end()) return 0;
+        sorted_keys.erase(it);
+        return 1;
+    }
+    std::size_t erase(const Key& key) { return erase<Key>(key); }
+
+    void clear() { sorted_keys.clear(); }
+};
+
+// ============================================================================
+// FLAT_MAP - Parallel sorted key and value vectors (std::flat_map, C++23)
+// Keys are packed together, so a lookup touches only key cache lines; the
+// value is fetched once, at the found index.
+// Reference: https://en.cppreference.com/w/cpp/container/flat_map
+// ============================================================================
+template<typename Key, typename T, typename Compare = std::less<Key>, typename Search = branchless_search>
+class flat_map {
+private:
+    std::vector<Key> sorted_keys;
+    std::vector<T> mapped;
+    Compare comp;
+
+    template<typename K>
+    static constexpr bool lookup_ok = std::is_same_v<K, Key> || requires { typename Compare::is_transparent; };
+
+    template<typename K>
+    std::size_t lower_index(const K& key) const {
+        return static_cast<std::size_t>(
+            Search::lower_bound(sorted_keys.begin(), sorted_keys.end(), key, comp) - sorted_keys.begin());
+    }
+
+    template<typename K>
+    std::size_t find_index(const K& key) const {
+        std::size_t i = lower_index(key);
+        return (i < size() && !comp(key, sorted_keys[i])) ? i : size();
+    }
+
+    // Sorts by key (stable, so the first occurrence of a duplicate wins) and dedupes
+    void sort_unique(std::vector<std::pair<Key, T>>& items) const {
+        std::stable_sort(items.begin(), items.end(),
+                         [&](const auto& a, const auto& b) { return comp(a.first, b.first); });
+        auto last = std::unique(items.begin(), items.end(), [&](const auto& a, const auto& b) {
+            return !comp(a.first, b.first) && !comp(b.first, a.first);
+        });
+        items.erase(last, items.end());
+    }
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class flat_map;
+        using map_type = std::conditional_t<Const, const flat_map, flat_map>;
+        map_type* owner = nullptr;
+        std::size_t index = 0;
+
+        basic_iterator(map_type* m, std::size_t i) : owner(m), index(i) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<Key, T>;
+        using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+        // operator-> needs an address, so the proxy pair is returned by value inside a holder
+        struct pointer {
+            reference ref;
+            reference* operator->() { return &ref; }
+        };
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(owner, index); }
+
+        reference operator*() const { return {owner->sorted_keys[index], owner->mapped[index]}; }
+        pointer operator->() const { return pointer{**this}; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        basic_iterator& operator++() { ++index; return *this; }
+        basic_iterator& operator--() { --index; return *this; }
+        basic_iterator operator++(int) { auto tmp = *this; ++index; return tmp; }
+        basic_iterator operator--(int) { auto tmp = *this; --index; return tmp; }
+        basic_iterator& operator+=(difference_type n) { index += n; return *this; }
+        basic_iterator& operator-=(difference_type n) { index -= n; return *this; }
+        friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        bool operator==(const basic_iterator& other) const { return index == other.index; }
+        auto operator<=>(const basic_iterator& other) const { return index <=> other.index; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    flat_map() = default;
+
+    // Bulk build from unsorted pairs: one sort, one pass to split keys and values
+    explicit flat_map(std::vector<std::pair<Key, T>> items, const Compare& c = Compare()) : comp(c) {
+        sort_unique(items);
+        sorted_keys.reserve(items.size());
+        mapped.reserve(items.size());
+        for (auto& [k, v] : items) {
+            sorted_keys.push_back(std::move(k));
+            mapped.push_back(std::move(v));
+        }
+    }
+
+    flat_map(std::initializer_list<std::pair<Key, T>> init)
+        : flat_map(std::vector<std::pair<Key, T>>(init)) {}
+
+    flat_map(sorted_unique_t, std::vector<Key> keys, std::vector<T> values, const Compare& c = Compare())
+        : sorted_keys(std::move(keys)), mapped(std::move(values)), comp(c) {
+        if (sorted_keys.size() != mapped.size())
+            throw std::invalid_argument("flat_map: key and value counts differ");
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    std::size_t size() const { return sorted_keys.size(); }
+    bool empty() const { return sorted_keys.empty(); }
+    void reserve(std::size_t n) {
+        sorted_keys.reserve(n);
+        mapped.reserve(n);
+    }
+    void clear() {
+        sorted_keys.clear();
+        mapped.clear();
+    }
+
+    std::span<const Key> keys() const { return sorted_keys; }
+    std::span<const T> values() const { return mapped; }
+
+    template<typename K> requires lookup_ok<K>
+    iterator find(const K& key) { return iterator(this, find_index(key)); }
+    iterator find(const Key& key) { return find<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    const_iterator find(const K& key) const { return const_iterator(this, find_index(key)); }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    bool contains(const K& key) const { return find_index(key) != size(); }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    const_iterator lower_bound(const K& key) const { return const_iterator(this, lower_index(key)); }
+    const_iterator lower_bound(const Key& key) const { return lower_bound<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    T& at(const K& key) {
+        std::size_t i = find_index(key);
+        if (i == size()) throw std::out_of_range("flat_map::at");
+        return mapped[i];
+    }
+    T& at(const Key& key) { return at<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    const T& at(const K& key) const {
+        std::size_t i = find_index(key);
+        if (i == size()) throw std::out_of_range("flat_map::at");
+        return mapped[i];
+    }
+    const T& at(const Key& key) const { return at<Key>(key); }
+
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        std::size_t i = lower_index(key);
+        if (i < size() && !comp(key, sorted_keys[i])) return {iterator(this, i), false};
+        sorted_keys.insert(sorted_keys.begin() + static_cast<std::ptrdiff_t>(i), key);
+        mapped.insert(mapped.begin() + static_cast<std::ptrdiff_t>(i), T(std::forward<Args>(args)...));
+        return {iterator(this, i), true};
+    }
+
+    std::pair<iterator, bool> insert(const std::pair<Key, T>& item) {
+        return try_emplace(item.first, item.second);
+    }
+
+    std::pair<iterator, bool> insert_or_assign(const Key& key, const T& value) {
+        auto result = try_emplace(key, value);
+        if (!result.second) result.first->second = value;
+        return result;
+    }
+
+    // Batched insert: sort the batch, then one linear merge into fresh arrays.
+    // Existing keys win over duplicates in the batch, as with repeated insert().
+    template<std::ranges::input_range R>
+    void insert_range(R&& range) {
+        std::vector<std::pair<Key, T>> incoming(std::ranges::begin(range), std::ranges::end(range));
+        sort_unique(incoming);
+
+        std::vector<Key> keys_out;
+        std::vector<T> values_out;
+        keys_out.reserve(size() + incoming.size());
+        values_out.reserve(size() + incoming.size());
+
+        std::size_t i = 0, j = 0;
+        while (i < size() || j < incoming.size()) {
+            if (j == incoming.size() || (i < size() && !comp(incoming[j].first, sorted_keys[i]))) {
+                if (j < incoming.size() && !comp(sorted_keys[i], incoming[j].first)) ++j;  // Duplicate
+                keys_out.push_back(std::move(sorted_keys[i]));
+                values_out.push_back(std::move(mapped[i]));
+                ++i;
+            } else {
+                keys_out.push_back(std::move(incoming[j].first));
+                values_out.push_back(std::move(incoming[j].second));
+                ++j;
+            }
+        }
+        sorted_keys = std::move(keys_out);
+        mapped = std::move(values_out);
+    }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t erase(const K& key) {
+        std::size_t i = find_index(key);
+        if (i == size()) return 0;
+        sorted_keys.erase(sorted_keys.begin() + static_cast<std::ptrdiff_t>(i));
+        mapped.erase(mapped.begin() + static_cast<std::ptrdiff_t>(i));
+        return 1;
+    }
+    std::size_t erase(const Key& key) { return erase<Key>(key); }
+};
+
+void demonstrate_flat_containers() {
+    std::cout << "\n=== FLAT MAP / FLAT SET ===\n";
+
+    // Bulk build from unsorted input with a duplicate
+    flat_set<int> primes = {11, 2, 7, 3, 5, 13, 7};
+    std::cout << "flat_set from {11,2,7,3,5,13,7}: ";
+    for (int p : primes) std::cout << p << " ";
+    std::cout << std::format("(size {})\n", primes.size());
+
+    primes.insert_range(std::vector<int>{19, 17, 2, 23});
+    std::cout << "After insert_range({19,17,2,23}): ";
+    for (int p : primes) std::cout << p << " ";
+    std::cout << std::format("\ncontains(17)={}, contains(4)={}, *lower_bound(8)={}\n",
+                             primes.contains(17), primes.contains(4), *primes.lower_bound(8));
+
+    // std::less<> is transparent: look up with string_view without building a std::string
+    flat_map<std::string, int, std::less<>> stock = {{"pear", 4}, {"apple", 10}, {"fig", 0}, {"kiwi", 7}};
+    std::string_view query = "apple";
+    std::cout << std::format("stock.at(string_view \"apple\") = {}\n", stock.at(query));
+    std::cout << std::format("contains(\"fig\")={}, contains(\"plum\")={}\n",
+                             stock.contains(std::string_view("fig")), stock.contains(std::string_view("plum")));
+
+    stock["plum"] = 3;
+    stock.insert_or_assign("fig", 12);
+    stock.insert_range(std::vector<std::pair<std::string, int>>{{"banana", 6}, {"apple", 99}, {"cherry", 2}});
+    std::cout << "After operator[], insert_or_assign and insert_range:\n  ";
+    for (auto [name, count] : stock) std::cout << name << "=" << count << " ";
+    std::cout << "\n";
+
+    // Keys are contiguous and can be handed out as a span
+    std::cout << "keys(): ";
+    for (const auto& k : stock.keys()) std::cout << k << " ";
+    std::cout << "\n";
+
+    stock.erase(std::string_view("kiwi"));
+    try {
+        stock.at(std::string_view("kiwi"));
+    } catch (const std::out_of_range& e) {
+        std::cout << "at(\"kiwi\") after erase threw: " << e.what() << "\n";
+    }
+
+    // The branchless search returns exactly what std::lower_bound does
+    std::vector<int> sorted = {1, 3, 3, 5, 8, 13};
+    bool agree = true;
+    for (int k = 0; k <= 14; ++k) {
+        auto a = std_search::lower_bound(sorted.begin(), sorted.end(), k, std::less<>());
+        auto b = branchless_search::lower_bound(sorted.begin(), sorted.end(), k, std::less<>());
+        agree = agree && a == b;
+    }
+    std::cout << "branchless lower_bound matches std::lower_bound: " << std::boolalpha << agree << "\n";
+}
+
+// ============================================================================
+// LOOKUP BENCHMARK - std::map vs flat_map (std and branchless search)
+// Default sizes run 100 to 1M keys; CPP26_BENCH_SCALE=10 extends them to 10M.
+// ============================================================================
+void demonstrate_flat_map_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== FLAT MAP BENCHMARK ===\n";
+
+    const std::size_t queries = scaled(1 << 20);
+    for (std::size_t base : {100, 10'000, 1'000'000}) {
+        const std::size_t n = scaled(base);
+        SplitMix64 rng(n);
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> items(n);
+        for (std::size_t i = 0; i < n; ++i) items[i] = {rng.next(), i};
+
+        std::vector<std::uint64_t> probes(queries);
+        for (auto& p : probes) p = items[rng.next() % n].first;
+
+        std::cout << std::format("n = {} ({} lookups):\n", n, queries);
+
+        std::map<std::uint64_t, std::uint64_t> tree;
+        print_result("build std::map (n inserts)", time_ms([&] {
+            for (const auto& [k, v] : items) tree.emplace(k, v);
+        }), n);
+
+        flat_map<std::uint64_t, std::uint64_t, std::less<>, std_search> flat_std;
+        print_result("build flat_map (sort once)", time_ms([&] { flat_std = decltype(flat_std)(items); }), n);
+        flat_map<std::uint64_t, std::uint64_t, std::less<>, branchless_search> flat_branchless(items);
+
+        auto run = [&](const auto& m) {
+            std::uint64_t sum = 0;
+            for (auto p : probes) sum += m.find(p)->second;
+            do_not_optimize(sum);
+        };
+        print_result("std::map::find", best_of_ms(3, [&] { run(tree); }), queries);
+        print_result("flat_map find (std::lower_bound)", best_of_ms(3, [&] { run(flat_std); }), queries);
+        print_result("flat_map find (branchless)", best_of_ms(3, [&] { run(flat_branchless); }), queries);
+    }
+}
+
+void run_all_demos() {
+    demonstrate_flat_containers();
+    demonstrate_flat_map_benchmark();
+}
+
+} // namespace cpp26_flat
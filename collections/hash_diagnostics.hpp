@@ -0,0 +1,538 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <span>
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <type_traits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+#include "hashing.hpp"
+#include "swiss_table.hpp"
+#include "concurrent_hash_map.hpp"
+
+namespace cpp26_hash_diagnostics {
+
+// ============================================================================
+// HASH TABLE DIAGNOSTICS - Where the lookups in a hash table actually go
+// load_factor() is an average; slow lookups come from the tail. analyze()
+// walks a table and measures:
+//   - occupancy: elements per bucket (chaining) or lengths of runs of full
+//     slots or groups (open addressing), i.e. clustering
+//   - probe lengths: nodes, slots or groups a successful lookup visits
+//   - the longest chains / probe sequences, with their keys
+//   - skew: how unevenly keys spread over their home buckets, as observed
+//     over expected sum of squared bucket sizes. A uniform hash scores 1.0;
+//     a hash that ignores key bits scores far above it.
+// Works on anything with the standard bucket interface (std::unordered_*),
+// and on open-addressing tables that expose home_count() and
+// for_each_probe(f) (flat_hash_map, flat_hash_set, concurrent_hash_map).
+// measure_hash() compares hash functions on a key set, and
+// trace_rehashes() records when and how expensively a table grows.
+// Reference: Knuth, TAOCP Vol. 3, 6.4 (analysis of hashing)
+// ============================================================================
+namespace detail {
+
+inline bool is_prime(std::size_t n) {
+    if (n < 2) return false;
+    for (std::size_t d = 2; d * d <= n; ++d)
+        if (n % d == 0) return false;
+    return true;
+}
+
+inline std::size_t next_prime(std::size_t n) {
+    while (!is_prime(n)) ++n;
+    return n;
+}
+
+// Keys as they appear in a report; "?" for types without a text form
+template<typename K>
+std::string key_text(const K& key) {
+    if constexpr (std::is_convertible_v<const K&, std::string_view>) return std::format("\"{}\"", std::string_view(key));
+    else if constexpr (std::is_arithmetic_v<K>) return std::format("{}", key);
+    else return "?";
+}
+
+// Elements of maps are pairs; sets store the key itself
+template<typename C, typename V>
+const auto& key_of(const V& value) {
+    if constexpr (requires { typename C::mapped_type; }) return value.first;
+    else return value;
+}
+
+// Observed / expected sum of squared home counts for n keys thrown
+// uniformly at random into m homes: E[sum b^2] = n + n(n-1)/m
+inline double skew_of(double sum_squares, double n, double m) {
+    if (n == 0 || m == 0) return 1.0;
+    return sum_squares / (n + n * (n - 1) / m);
+}
+
+} // namespace detail
+
+// Chaining tables: the std::unordered_* bucket interface
+template<typename C>
+concept bucket_interface = requires(const C& c, std::size_t i) {
+    { c.size() } -> std::convertible_to<std::size_t>;
+    { c.bucket_count() } -> std::convertible_to<std::size_t>;
+    { c.bucket_size(i) } -> std::convertible_to<std::size_t>;
+    c.begin(i);
+    c.end(i);
+};
+
+// Open-addressing tables: f(key, slot, home, probes) for every element,
+// where home is one of home_count() probe start positions. for_each_probe
+// returns the slot count its positions refer to, which a concurrent table
+// may have grown past bucket_count() by the time the walk ends.
+template<typename C>
+concept probe_interface = requires(const C& c) {
+    { c.size() } -> std::convertible_to<std::size_t>;
+    { c.bucket_count() } -> std::convertible_to<std::size_t>;
+    { c.home_count() } -> std::convertible_to<std::size_t>;
+    { c.for_each_probe([](const auto&, std::size_t, std::size_t, std::size_t) {}) } -> std::convertible_to<std::size_t>;
+};
+
+// ============================================================================
+// HISTOGRAM - Counts of small non-negative values; the last bin collects
+// every value at or above it
+// ============================================================================
+class histogram {
+private:
+    std::vector<std::size_t> bins;
+    std::size_t samples = 0;
+    std::size_t total = 0;
+    std::size_t largest = 0;
+
+public:
+    explicit histogram(std::size_t last_bin = 16) : bins(last_bin + 1) {}
+
+    void add(std::size_t value, std::size_t times = 1) {
+        bins[std::min(value, bins.size() - 1)] += times;
+        samples += times;
+        total += value * times;
+        if (times) largest = std::max(largest, value);
+    }
+
+    std::size_t count() const { return samples; }
+    std::size_t bin(std::size_t i) const { return i < bins.size() ? bins[i] : 0; }
+    std::size_t max() const { return largest; }
+    double mean() const { return samples ? static_cast<double>(total) / static_cast<double>(samples) : 0.0; }
+
+    // Smallest value v with at least fraction p of samples <= v (bin-capped)
+    std::size_t percentile(double p) const {
+        auto target = static_cast<std::size_t>(std::ceil(p * static_cast<double>(samples)));
+        std::size_t seen = 0;
+        for (std::size_t i = 0; i < bins.size(); ++i)
+            if ((seen += bins[i]) >= target && seen) return i == bins.size() - 1 ? largest : i;
+        return 0;
+    }
+
+    // One row per non-empty bin: value | bar percent
+    std::string to_string(std::string_view indent = "    ") const {
+        std::string out;
+        if (samples == 0) return out;
+        std::size_t peak = *std::max_element(bins.begin(), bins.end());
+        for (std::size_t i = 0; i < bins.size(); ++i) {
+            if (bins[i] == 0) continue;
+            double share = static_cast<double>(bins[i]) / static_cast<double>(samples);
+            std::size_t bar = peak ? (bins[i] * 40 + peak - 1) / peak : 0;
+            out += std::format("{}{:>3}{} | {:<40} {:5.1f}%\n", indent, i, i == bins.size() - 1 ? "+" : " ",
+                               std::string(bar, '#'), share * 100);
+        }
+        return out;
+    }
+};
+
+// ============================================================================
+// TABLE STATS - What analyze() measures; report() formats it
+// ============================================================================
+struct hot_spot {
+    std::size_t location = 0;       // Bucket (chaining) or slot (open addressing)
+    std::size_t length = 0;         // Chain length, or probes the lookup needs
+    std::vector<std::string> keys;  // Up to four keys found there
+};
+
+struct table_stats {
+    bool open_addressing = false;
+    std::size_t size = 0;
+    std::size_t buckets = 0;        // Buckets or slots
+    std::size_t homes = 0;          // Possible probe start positions (== buckets for chaining)
+    std::size_t slots_per_home = 1; // Open addressing: group width, or 1 for per-slot probing
+    std::size_t empty_homes = 0;    // Homes no key hashes to
+    double load_factor = 0;
+    double max_load_factor = 0;     // 0 if the table does not say
+    double skew = 1.0;
+    histogram occupancy;            // Bucket sizes, or lengths of runs of full slots / groups
+    histogram probes;               // Per element: nodes / probes for a successful lookup
+    std::vector<hot_spot> longest;
+
+    // Fraction of homes a uniform hash would leave empty: e^-(n/m)
+    double expected_empty_fraction() const {
+        return homes ? std::exp(-static_cast<double>(size) / static_cast<double>(homes)) : 0.0;
+    }
+
+    // OK / WARN / BAD with the numbers behind it; small tables are not judged
+    std::string verdict() const {
+        double empty = homes ? static_cast<double>(empty_homes) / static_cast<double>(homes) : 0.0;
+        std::string_view level = size < 64 ? "too small to judge" : skew >= 2.0 ? "BAD" : skew >= 1.25 ? "WARN" : "OK";
+        return std::format("{} - skew {:.2f} (1.00 = uniform hash), empty {} {:.1f}% (uniform: {:.1f}%)", level, skew,
+                           open_addressing ? "homes" : "buckets", empty * 100, expected_empty_fraction() * 100);
+    }
+};
+
+namespace detail {
+
+// Keeps the `limit` longest entries seen, longest first
+inline void keep_longest(std::vector<hot_spot>& top, std::size_t limit, hot_spot&& spot) {
+    if (limit == 0) return;
+    if (top.size() == limit && spot.length <= top.back().length) return;
+    auto pos = std::upper_bound(top.begin(), top.end(), spot.length,
+                                [](std::size_t len, const hot_spot& h) { return len > h.length; });
+    top.insert(pos, std::move(spot));
+    if (top.size() > limit) top.pop_back();
+}
+
+} // namespace detail
+
+template<bucket_interface C>
+table_stats analyze(const C& c, std::size_t top = 5) {
+    table_stats stats;
+    stats.size = c.size();
+    stats.buckets = stats.homes = c.bucket_count();
+    stats.load_factor = stats.buckets ? static_cast<double>(stats.size) / static_cast<double>(stats.buckets) : 0.0;
+    if constexpr (requires { c.max_load_factor(); }) stats.max_load_factor = c.max_load_factor();
+
+    double sum_squares = 0;
+    for (std::size_t b = 0; b < stats.buckets; ++b) {
+        std::size_t len = c.bucket_size(b);
+        stats.occupancy.add(len);
+        stats.empty_homes += len == 0;
+        sum_squares += static_cast<double>(len) * static_cast<double>(len);
+        // The k-th node of a chain takes k comparisons to reach
+        for (std::size_t k = 1; k <= len; ++k) stats.probes.add(k);
+
+        if (len == 0 || top == 0 || (stats.longest.size() == top && len <= stats.longest.back().length)) continue;
+        hot_spot spot{b, len, {}};
+        for (auto it = c.begin(b); it != c.end(b) && spot.keys.size() < 4; ++it)
+            spot.keys.push_back(detail::key_text(detail::key_of<C>(*it)));
+        detail::keep_longest(stats.longest, top, std::move(spot));
+    }
+    stats.skew = detail::skew_of(sum_squares, static_cast<double>(stats.size), static_cast<double>(stats.homes));
+    return stats;
+}
+
+template<probe_interface C>
+table_stats analyze(const C& c, std::size_t top = 5) {
+    table_stats stats;
+    stats.open_addressing = true;
+    if constexpr (requires { c.max_load_factor(); }) stats.max_load_factor = c.max_load_factor();
+
+    // Sized up front, but a table that writers grow during the walk reports
+    // positions past these sizes, so they follow what the walk sees; size,
+    // slots and homes all come from the walk itself
+    std::size_t homes = c.home_count();
+    std::vector<std::uint32_t> per_home(homes);
+    std::vector<bool> full(c.bucket_count());
+    stats.slots_per_home = homes ? std::max<std::size_t>(full.size() / homes, 1) : 1;
+    stats.buckets = c.for_each_probe([&](const auto& key, std::size_t slot, std::size_t home, std::size_t probes) {
+        if (home >= per_home.size()) per_home.resize(home + 1);
+        if (slot >= full.size()) full.resize(slot + 1);
+        ++per_home[home];
+        full[slot] = true;
+        ++stats.size;
+        stats.probes.add(probes);
+        if (top && (stats.longest.size() < top || probes > stats.longest.back().length))
+            detail::keep_longest(stats.longest, top, hot_spot{slot, probes, {detail::key_text(key)}});
+    });
+    stats.homes = stats.buckets / stats.slots_per_home;
+    per_home.resize(stats.homes);
+    full.resize(stats.buckets);
+    stats.load_factor = stats.buckets ? static_cast<double>(stats.size) / static_cast<double>(stats.buckets) : 0.0;
+
+    double sum_squares = 0;
+    for (auto n : per_home) {
+        stats.empty_homes += n == 0;
+        sum_squares += static_cast<double>(n) * n;
+    }
+    stats.skew = detail::skew_of(sum_squares, static_cast<double>(stats.size), static_cast<double>(stats.homes));
+
+    // Clustering: a lookup that starts inside a run of full slots (or full
+    // groups, where a group is the unit of probing) may have to cross all of it
+    const std::size_t w = stats.slots_per_home;
+    auto block_full = [&](std::size_t b) {
+        return std::all_of(full.begin() + b * w, full.begin() + (b + 1) * w, [](bool f) { return f; });
+    };
+    for (std::size_t b = 0; b < stats.homes;) {
+        std::size_t e = b;
+        while (e < stats.homes && block_full(e)) ++e;
+        if (e > b) stats.occupancy.add(e - b);
+        b = e + 1;
+    }
+    return stats;
+}
+
+// One-call report for logs and production dumps
+template<typename C> requires bucket_interface<C> || probe_interface<C>
+std::string report(const C& c, std::string_view name, std::size_t top = 5) {
+    table_stats s = analyze(c, top);
+    std::string out = std::format("[{}] {}, {} elements in {} {} (load {:.2f}", name,
+                                  s.open_addressing ? "open addressing" : "chaining", s.size, s.buckets,
+                                  s.open_addressing ? "slots" : "buckets", s.load_factor);
+    out += s.max_load_factor > 0 ? std::format(" / max {:.2f})\n", s.max_load_factor) : std::string(")\n");
+    out += std::format("  verdict: {}\n", s.verdict());
+    out += std::format("  {} per successful lookup: mean {:.2f}, p99 {}, max {}\n",
+                       s.open_addressing ? "probes" : "nodes", s.probes.mean(), s.probes.percentile(0.99),
+                       s.probes.max());
+    if (!s.open_addressing) out += "  bucket sizes:\n";
+    else out += std::format("  runs of full {}:\n", s.slots_per_home == 1 ? "slots" : "groups");
+    out += s.occupancy.count() ? s.occupancy.to_string() : "    (none)\n";
+    out += s.open_addressing ? "  longest probes:\n" : "  longest chains:\n";
+    for (const auto& spot : s.longest) {
+        std::string keys;
+        for (const auto& k : spot.keys) keys += (keys.empty() ? "" : ", ") + k;
+        out += std::format("    {} {:>8}: {:>4}  [{}]\n", s.open_addressing ? "slot  " : "bucket", spot.location,
+                           spot.length, keys);
+    }
+    return out;
+}
+
+// ============================================================================
+// HASH QUALITY - Collision rates of one hash function on a key set
+// Buckets are taken two ways: modulo a prime (libstdc++ unordered_map) and
+// from the low bits (power-of-two tables). Identity-like hashes survive the
+// first and fail the second.
+// ============================================================================
+struct hash_quality {
+    std::string name;
+    std::size_t keys = 0;
+    std::size_t buckets = 0;          // Power of two; the prime is the next one above it
+    std::size_t full_collisions = 0;  // Keys whose whole hash value repeats an earlier key's
+    double prime_rate = 0;            // Keys landing in an already occupied bucket, hash % prime
+    double mask_rate = 0;             // Same, hash & (buckets - 1)
+    double expected_rate = 0;         // Uniform random hash at this load
+};
+
+template<typename Key, typename Hash>
+hash_quality measure_hash(std::string_view name, std::span<const Key> keys, Hash hash) {
+    hash_quality q{std::string(name), keys.size(), std::bit_ceil(std::max<std::size_t>(keys.size(), 1))};
+    const std::size_t prime = detail::next_prime(q.buckets);
+
+    std::vector<std::uint64_t> hashes;
+    hashes.reserve(keys.size());
+    for (const auto& k : keys) hashes.push_back(static_cast<std::uint64_t>(hash(k)));
+
+    auto collision_rate = [&](std::size_t m, auto bucket_of) {
+        std::vector<bool> used(m);
+        std::size_t collided = 0;
+        for (auto h : hashes) {
+            std::size_t b = bucket_of(h);
+            collided += used[b];
+            used[b] = true;
+        }
+        return keys.empty() ? 0.0 : static_cast<double>(collided) / static_cast<double>(keys.size());
+    };
+    q.prime_rate = collision_rate(prime, [&](std::uint64_t h) { return h % prime; });
+    q.mask_rate = collision_rate(q.buckets, [&](std::uint64_t h) { return h & (q.buckets - 1); });
+
+    // n keys in m buckets occupy m(1 - (1 - 1/m)^n) of them on average
+    double n = static_cast<double>(keys.size()), m = static_cast<double>(q.buckets);
+    q.expected_rate = n ? 1.0 - m * (1.0 - std::pow(1.0 - 1.0 / m, n)) / n : 0.0;
+
+    std::sort(hashes.begin(), hashes.end());
+    q.full_collisions = static_cast<std::size_t>(hashes.end() - std::unique(hashes.begin(), hashes.end()));
+    return q;
+}
+
+inline std::string format_hash_table(std::span<const hash_quality> rows) {
+    std::string out = std::format("  {:<28} {:>8} {:>10} {:>10} {:>10} {:>10}\n", "hash", "keys", "% prime",
+                                  "% pow2", "% uniform", "64-bit eq");
+    for (const auto& q : rows)
+        out += std::format("  {:<28} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10}\n", q.name, q.keys,
+                           q.prime_rate * 100, q.mask_rate * 100, q.expected_rate * 100, q.full_collisions);
+    return out;
+}
+
+// ============================================================================
+// REHASH TRACE - Inserts values one at a time and records every growth
+// A rehash shows up as a change in bucket_count(); its cost is the time of
+// the insert that triggered it. Reading the clock adds tens of nanoseconds
+// per insert, so compare traces with each other, not with benchmarks.
+// ============================================================================
+struct rehash_event {
+    std::size_t size = 0;   // Elements after the triggering insert
+    std::size_t from = 0;   // bucket_count() before
+    std::size_t to = 0;     // bucket_count() after
+    double ms = 0;
+};
+
+struct rehash_trace {
+    std::vector<rehash_event> events;
+    std::size_t inserts = 0;
+    double total_ms = 0;
+
+    double rehash_ms() const {
+        double ms = 0;
+        for (const auto& e : events) ms += e.ms;
+        return ms;
+    }
+
+    std::string to_string(std::string_view name, std::size_t max_rows = 6) const {
+        std::string out = std::format("[{}] {} inserts, {} rehashes: {:.2f} of {:.2f} ms ({:.0f}%) spent rehashing\n",
+                                      name, inserts, events.size(), rehash_ms(), total_ms,
+                                      total_ms > 0 ? rehash_ms() / total_ms * 100 : 0.0);
+        // The largest rehashes dominate; show the last few
+        std::size_t first = events.size() > max_rows ? events.size() - max_rows : 0;
+        if (first) out += std::format("    ... {} earlier\n", first);
+        for (std::size_t i = first; i < events.size(); ++i)
+            out += std::format("    at {:>8}: {:>8} -> {:>8} buckets  {:8.3f} ms\n", events[i].size, events[i].from,
+                               events[i].to, events[i].ms);
+        return out;
+    }
+};
+
+template<typename Container, typename Range>
+rehash_trace trace_rehashes(Container& c, const Range& values) {
+    using clock = std::chrono::steady_clock;
+    rehash_trace trace;
+    for (const auto& v : values) {
+        std::size_t before = c.bucket_count();
+        auto start = clock::now();
+        if constexpr (requires { c.insert(v); }) c.insert(v);
+        else c.insert(v.first, v.second);
+        double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        trace.total_ms += ms;
+        ++trace.inserts;
+        if (std::size_t after = c.bucket_count(); after != before)
+            trace.events.push_back({c.size(), before, after, ms});
+    }
+    return trace;
+}
+
+// ============================================================================
+// EXAMPLES - Deliberately weak hashes, and the tables they produce
+// ============================================================================
+
+// Sums the bytes: anagrams and same-length ids with shuffled digits collide
+struct byte_sum_hash {
+    std::size_t operator()(std::string_view s) const {
+        std::size_t h = 0;
+        for (unsigned char ch : s) h += ch;
+        return h;
+    }
+};
+
+// Passes integers through unchanged, and claims to mix them so that
+// flat_hash_map trusts it: fine for sequential keys, bad for strided ones
+struct identity_hash {
+    using is_avalanching = void;
+    std::size_t operator()(std::uint64_t x) const { return x; }
+};
+
+struct mixed_hash {
+    std::size_t operator()(std::uint64_t x) const { return cpp26_hash::mix_murmur3(x); }
+};
+
+struct fnv1a_hash {
+    std::size_t operator()(std::string_view s) const { return cpp26_hash::fnv1a64(s.data(), s.size()); }
+};
+
+void demonstrate_hash_diagnostics() {
+    std::cout << "\n=== HASH TABLE DIAGNOSTICS ===\n";
+    const std::size_t n = cpp26_benchmark::scaled(20'000);
+
+    std::vector<std::string> ids;
+    for (std::size_t i = 0; i < n; ++i) ids.push_back(std::format("user:{:06}", i));
+
+    // demonstrate_unordered_map shows bucket_count and load_factor; these
+    // two tables have the same numbers and very different lookups
+    std::unordered_map<std::string, int> good;
+    std::unordered_map<std::string, int, byte_sum_hash> bad;
+    for (std::size_t i = 0; i < n; ++i) {
+        good.emplace(ids[i], static_cast<int>(i));
+        bad.emplace(ids[i], static_cast<int>(i));
+    }
+    std::cout << report(good, "unordered_map<string>, std::hash", 3) << '\n';
+    std::cout << report(bad, "unordered_map<string>, byte sum", 3) << '\n';
+
+    // Strided keys: the identity hash puts every key in the same few groups
+    const std::size_t m = cpp26_benchmark::scaled(4'000);
+    cpp26_swiss::flat_hash_map<std::uint64_t, std::uint64_t> flat_good;
+    cpp26_swiss::flat_hash_map<std::uint64_t, std::uint64_t, identity_hash> flat_bad;
+    for (std::uint64_t i = 0; i < m; ++i) {
+        flat_good.emplace(i << 16, i);
+        flat_bad.emplace(i << 16, i);
+    }
+    std::cout << report(flat_good, "flat_hash_map<u64>, keys i<<16, std::hash", 3) << '\n';
+    std::cout << report(flat_bad, "flat_hash_map<u64>, keys i<<16, identity", 3) << '\n';
+
+    cpp26_concurrent_hash::concurrent_hash_map<std::uint64_t, std::uint64_t> shared(16);
+    for (std::uint64_t i = 0; i < m; ++i) shared.insert(i << 16, i);
+    std::cout << report(shared, "concurrent_hash_map<u64>, keys i<<16", 3) << '\n';
+}
+
+void demonstrate_hash_quality() {
+    std::cout << "\n=== HASH FUNCTION COLLISION RATES ===\n";
+    const std::size_t n = cpp26_benchmark::scaled(50'000);
+
+    std::vector<std::uint64_t> sequential(n), strided(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        sequential[i] = i;
+        strided[i] = i << 12;
+    }
+    std::vector<std::string> ids;
+    for (std::size_t i = 0; i < n; ++i) ids.push_back(std::format("user:{:06}", i));
+
+    std::vector<hash_quality> rows;
+    rows.push_back(measure_hash<std::uint64_t>("sequential, std::hash", sequential, std::hash<std::uint64_t>{}));
+    rows.push_back(measure_hash<std::uint64_t>("sequential, mix64", sequential, mixed_hash{}));
+    rows.push_back(measure_hash<std::uint64_t>("i<<12, std::hash", strided, std::hash<std::uint64_t>{}));
+    rows.push_back(measure_hash<std::uint64_t>("i<<12, mix64", strided, mixed_hash{}));
+    rows.push_back(measure_hash<std::string>("ids, std::hash", ids, std::hash<std::string>{}));
+    rows.push_back(measure_hash<std::string>("ids, FNV-1a", ids, fnv1a_hash{}));
+    rows.push_back(measure_hash<std::string>("ids, byte sum", ids, byte_sum_hash{}));
+    std::cout << format_hash_table(rows);
+    std::cout << "  (% = keys landing in an already occupied bucket. Under the identity\n"
+                 "   std::hash, sequential integers beat random; strided ones reach only\n"
+                 "   1 power-of-two bucket in 4096, so they collide almost every time)\n";
+}
+
+void demonstrate_rehash_trace() {
+    std::cout << "\n=== REHASH TRACE ===\n";
+    const std::size_t n = cpp26_benchmark::scaled(200'000);
+    cpp26_benchmark::SplitMix64 rng(7);
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> values(n);
+    for (auto& v : values) v = {rng.next(), 0};
+
+    std::unordered_map<std::uint64_t, std::uint64_t> grown;
+    std::cout << trace_rehashes(grown, values).to_string("unordered_map, grown");
+
+    std::unordered_map<std::uint64_t, std::uint64_t> reserved;
+    reserved.reserve(n);
+    std::cout << trace_rehashes(reserved, values).to_string("unordered_map, reserve(n)");
+
+    cpp26_swiss::flat_hash_map<std::uint64_t, std::uint64_t> flat;
+    std::cout << trace_rehashes(flat, values).to_string("flat_hash_map, grown");
+
+    cpp26_concurrent_hash::concurrent_hash_map<std::uint64_t, std::uint64_t> shared;
+    std::cout << trace_rehashes(shared, values).to_string("concurrent_hash_map, grown", 3);
+}
+
+void run_all_demos() {
+    demonstrate_hash_diagnostics();
+    demonstrate_hash_quality();
+    demonstrate_rehash_trace();
+}
+
+} // namespace cpp26_hash_diagnostics
@@ -0,0 +1,506 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <array>
+#include <tuple>
+#include <ranges>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <type_traits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_hash {
+
+// ============================================================================
+// FAST HASHING - Byte hashes, integer mixers and hash combinators
+// std::hash is the identity for integers in libstdc++, so a power-of-two
+// table that keeps the low bits sees only the low bits of the key. Its
+// string hash is a portable murmur variant.
+//   - wyhash: 64x64->128 multiply-fold per 16 bytes, a few cycles for
+//     short keys and several GB/s for long ones
+//   - xxhash64: the classic four-lane 32-byte stripe hash (XXH64)
+//   - fnv1a64: one multiply per byte, kept as the simple baseline
+// The fast_hash functor ties these together. It can be used as the Hash
+// parameter of any unordered container and declares is_avalanching, so
+// tables that mix the hash again (swiss_table.hpp) skip that step.
+// Reference: https://github.com/wangyi-fudan/wyhash
+//            https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+// ============================================================================
+namespace detail {
+
+inline std::uint64_t read64(const std::uint8_t* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    if constexpr (std::endian::native == std::endian::big) v = std::byteswap(v);
+    return v;
+}
+
+inline std::uint64_t read32(const std::uint8_t* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    if constexpr (std::endian::native == std::endian::big) v = std::byteswap(v);
+    return v;
+}
+
+// Full 64x64 -> 128-bit product, returned as (low, high)
+inline void multiply_128(std::uint64_t& a, std::uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = static_cast<__uint128_t>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+    std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    std::uint64_t t = rl + (rm0 << 32), c = t < rl;
+    std::uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+// Multiply and fold the 128-bit product back to 64 bits
+inline std::uint64_t mum(std::uint64_t a, std::uint64_t b) {
+    multiply_128(a, b);
+    return a ^ b;
+}
+
+inline constexpr std::uint64_t wy_secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+} // namespace detail
+
+// ============================================================================
+// BYTE HASHES
+// ============================================================================
+
+// wyhash (final version 4)
+inline std::uint64_t wyhash(const void* key, std::size_t len, std::uint64_t seed = 0) {
+    using namespace detail;
+    const auto* p = static_cast<const std::uint8_t*>(key);
+    const auto* s = wy_secret;
+    seed ^= mum(seed ^ s[0], s[1]);
+    std::uint64_t a, b;
+    if (len <= 16) [[likely]] {
+        if (len >= 4) [[likely]] {
+            // Two overlapping 4-byte reads from each end cover 4..16 bytes without a loop
+            std::size_t mid = (len >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + mid);
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - mid);
+        } else if (len > 0) [[likely]] {
+            a = (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[len >> 1]} << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        std::size_t i = len;
+        if (i > 48) [[unlikely]] {
+            // Three independent multiply chains keep the multiplier busy
+            std::uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = mum(read64(p) ^ s[1], read64(p + 8) ^ seed);
+                see1 = mum(read64(p + 16) ^ s[2], read64(p + 24) ^ see1);
+                see2 = mum(read64(p + 32) ^ s[3], read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) [[unlikely]] {
+            seed = mum(read64(p) ^ s[1], read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+    a ^= s[1];
+    b ^= seed;
+    multiply_128(a, b);
+    return mum(a ^ s[0] ^ len, b ^ s[1]);
+}
+
+// XXH64
+inline std::uint64_t xxhash64(const void* key, std::size_t len, std::uint64_t seed = 0) {
+    using detail::read64;
+    using detail::read32;
+    constexpr std::uint64_t p1 = 0x9E3779B185EBCA87ull, p2 = 0xC2B2AE3D27D4EB4Full, p3 = 0x165667B19E3779F9ull,
+                            p4 = 0x85EBCA77C2B2AE63ull, p5 = 0x27D4EB2F165667C5ull;
+    auto round = [](std::uint64_t acc, std::uint64_t input) {
+        return std::rotl(acc + input * p2, 31) * p1;
+    };
+    auto merge = [&](std::uint64_t acc, std::uint64_t v) {
+        return (acc ^ round(0, v)) * p1 + p4;
+    };
+
+    const auto* p = static_cast<const std::uint8_t*>(key);
+    const auto* end = p + len;
+    std::uint64_t h;
+    if (len >= 32) {
+        std::uint64_t v1 = seed + p1 + p2, v2 = seed + p2, v3 = seed, v4 = seed - p1;
+        do {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+        h = merge(merge(merge(merge(h, v1), v2), v3), v4);
+    } else {
+        h = seed + p5;
+    }
+    h += len;
+
+    for (; end - p >= 8; p += 8) h = std::rotl(h ^ round(0, read64(p)), 27) * p1 + p4;
+    if (end - p >= 4) {
+        h = std::rotl(h ^ (read32(p) * p1), 23) * p2 + p3;
+        p += 4;
+    }
+    for (; p < end; ++p) h = std::rotl(h ^ (*p * p5), 11) * p1;
+
+    h ^= h >> 33;
+    h *= p2;
+    h ^= h >> 29;
+    h *= p3;
+    h ^= h >> 32;
+    return h;
+}
+
+// FNV-1a, 64-bit
+inline std::uint64_t fnv1a64(const void* key, std::size_t len) {
+    const auto* p = static_cast<const std::uint8_t*>(key);
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for (std::size_t i = 0; i < len; ++i) h = (h ^ p[i]) * 0x100000001b3ull;
+    return h;
+}
+
+// ============================================================================
+// INTEGER MIXERS - Spread every key bit over the whole 64-bit hash
+// ============================================================================
+
+// MurmurHash3 fmix64 finalizer
+constexpr std::uint64_t mix_murmur3(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// SplitMix64 output function (Stafford variant 13) applied after a golden-ratio step
+constexpr std::uint64_t mix_splitmix(std::uint64_t h) {
+    h += 0x9E3779B97F4A7C15ull;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return h ^ (h >> 31);
+}
+
+// One 128-bit multiply folded to 64 bits (wyhash's mixer). Cheapest of the
+// three, but high input bits never reach the low half of the product, so it
+// avalanches poorly on its own; fine for combining already-mixed hashes.
+inline std::uint64_t mix_mum(std::uint64_t h) {
+    return detail::mum(h ^ detail::wy_secret[0], detail::wy_secret[1]);
+}
+
+// Folds the hash of the next field into a running seed; order matters
+inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t h) {
+    return detail::mum(seed ^ detail::wy_secret[2], h ^ detail::wy_secret[3]);
+}
+
+// ============================================================================
+// FAST_HASH - One transparent functor for strings, integers, tuples and structs
+// Equal values of different types hash the same (std::string and
+// const char*, int and long), so heterogeneous lookup is safe. Structs
+// opt in with a member `auto tie() const { return std::tie(a, b, c); }`.
+// ============================================================================
+template<typename T>
+concept string_like = std::is_convertible_v<const T&, std::string_view>;
+
+template<typename T>
+concept tieable = requires(const T& t) { t.tie(); };
+
+template<typename T>
+concept tuple_like = requires { std::tuple_size<T>::value; };
+
+struct fast_hash {
+    using is_transparent = void;
+    using is_avalanching = void;
+
+    template<typename T>
+    std::size_t operator()(const T& value) const {
+        return static_cast<std::size_t>(hash(value));
+    }
+
+private:
+    template<typename T>
+    static std::uint64_t hash(const T& value) {
+        if constexpr (string_like<T>) {
+            std::string_view s = value;
+            return wyhash(s.data(), s.size());
+        } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return mix_splitmix(static_cast<std::uint64_t>(value));
+        } else if constexpr (std::is_pointer_v<T>) {
+            return mix_splitmix(reinterpret_cast<std::uintptr_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            // +0.0 == -0.0 must hash alike; all other values hash their bits
+            double d = value == T{} ? 0.0 : static_cast<double>(value);
+            return mix_splitmix(std::bit_cast<std::uint64_t>(d));
+        } else if constexpr (tieable<T>) {
+            return hash(value.tie());
+        } else if constexpr (tuple_like<T>) {
+            return std::apply([](const auto&... fields) {
+                std::uint64_t seed = sizeof...(fields);
+                ((seed = hash_combine(seed, hash(fields))), ...);
+                return seed;
+            }, value);
+        } else if constexpr (std::ranges::contiguous_range<T> &&
+                             std::has_unique_object_representations_v<std::ranges::range_value_t<T>>) {
+            // Padding-free elements: equal ranges have equal bytes
+            return wyhash(std::ranges::data(value), std::ranges::size(value) * sizeof(std::ranges::range_value_t<T>));
+        } else if constexpr (std::ranges::input_range<T>) {
+            std::uint64_t seed = 0;
+            for (const auto& element : value) seed = hash_combine(seed, hash(element));
+            return seed;
+        } else {
+            static_assert(std::is_void_v<T>, "fast_hash: no hash for this type (add a tie() member?)");
+        }
+    }
+};
+
+// Hashes several values as one key: hash_values(x, y, name)
+template<typename... Ts>
+std::uint64_t hash_values(const Ts&... values) {
+    return fast_hash{}(std::forward_as_tuple(values...));
+}
+
+void demonstrate_hash_functions() {
+    std::cout << "\n=== FAST HASH FUNCTIONS ===\n";
+
+    std::string_view text = "The quick brown fox jumps over the lazy dog";
+    std::cout << std::format("Input: \"{}\" ({} bytes)\n", text, text.size());
+    std::cout << std::format("  wyhash      {:016x}\n", wyhash(text.data(), text.size()));
+    std::cout << std::format("  xxhash64    {:016x}\n", xxhash64(text.data(), text.size()));
+    std::cout << std::format("  fnv1a64     {:016x}\n", fnv1a64(text.data(), text.size()));
+    std::cout << std::format("  std::hash   {:016x}\n", std::hash<std::string_view>{}(text));
+
+    std::cout << "Integer keys 1, 2, 3:\n";
+    for (std::uint64_t k : {1, 2, 3}) {
+        std::cout << std::format("  std::hash {:016x}  murmur3 {:016x}  splitmix {:016x}  mum {:016x}\n",
+                                 std::hash<std::uint64_t>{}(k), mix_murmur3(k), mix_splitmix(k), mix_mum(k));
+    }
+
+    fast_hash h;
+    std::cout << std::format("fast_hash(std::string) == fast_hash(const char*): {}\n",
+                             h(std::string("key")) == h("key"));
+    std::cout << std::format("fast_hash(42) == fast_hash(42L): {}\n", h(42) == h(42L));
+
+    struct point {
+        int x, y;
+        std::string label;
+        auto tie() const { return std::tie(x, y, label); }
+    };
+    std::cout << std::format("fast_hash(point{{1, 2, \"a\"}}) == hash_values(1, 2, \"a\"): {}\n",
+                             h(point{1, 2, "a"}) == hash_values(1, 2, std::string_view("a")));
+    std::cout << std::format("hash_values(1, 2) != hash_values(2, 1): {}\n", hash_values(1, 2) != hash_values(2, 1));
+
+    std::unordered_map<std::string, int, fast_hash, std::equal_to<>> ages = {{"Alice", 25}, {"Bob", 30}};
+    std::cout << std::format("unordered_map<string, int, fast_hash>: find(\"Bob\") -> {}\n",
+                             ages.find(std::string_view("Bob"))->second);
+}
+
+// ============================================================================
+// QUALITY REPORT - Avalanche bias and low-bit bucket collisions
+// ============================================================================
+
+// Flips each input bit of random 64-bit keys and records how often each
+// output bit changes. An ideal hash flips every output bit half the time.
+struct avalanche_result {
+    double worst_bias;  // max |P(flip) - 0.5| over all input/output bit pairs
+    double mean_bias;
+};
+
+template<typename Hash64>
+avalanche_result avalanche(Hash64&& hash, std::size_t samples) {
+    std::vector<std::uint32_t> flips(64 * 64, 0);
+    cpp26_benchmark::SplitMix64 rng(12345);
+    for (std::size_t s = 0; s < samples; ++s) {
+        std::uint64_t x = rng.next();
+        std::uint64_t hx = hash(x);
+        for (int in = 0; in < 64; ++in) {
+            std::uint64_t diff = hx ^ hash(x ^ (std::uint64_t{1} << in));
+            for (int out = 0; out < 64; ++out) flips[in * 64 + out] += (diff >> out) & 1;
+        }
+    }
+    double worst = 0, total = 0;
+    for (auto f : flips) {
+        double bias = std::abs(static_cast<double>(f) / static_cast<double>(samples) - 0.5);
+        worst = std::max(worst, bias);
+        total += bias;
+    }
+    return {worst, total / static_cast<double>(flips.size())};
+}
+
+// Drops hashes into 2^bits buckets by their low bits, as a power-of-two
+// table does, and returns collisions relative to a uniformly random hash
+// (1.0 = as good as random, 0 = no collisions at all).
+template<typename Hash64>
+double bucket_collision_ratio(const std::vector<std::uint64_t>& hashes_in, unsigned bits, Hash64&& hash) {
+    const std::size_t buckets = std::size_t{1} << bits;
+    std::vector<std::uint8_t> used(buckets, 0);
+    std::size_t collisions = 0;
+    for (auto k : hashes_in) {
+        auto& slot = used[hash(k) & (buckets - 1)];
+        collisions += slot;
+        slot = 1;
+    }
+    double n = static_cast<double>(hashes_in.size()), m = static_cast<double>(buckets);
+    double expected = n - m * (1.0 - std::pow(1.0 - 1.0 / m, n));
+    return static_cast<double>(collisions) / expected;
+}
+
+void demonstrate_hash_quality() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== HASH QUALITY REPORT ===\n";
+
+    // Integer hashes and 8-byte keys run through the byte hashes
+    auto as_bytes = [](auto byte_hash) {
+        return [byte_hash](std::uint64_t x) { return byte_hash(&x, sizeof(x)); };
+    };
+    auto wy = as_bytes([](const void* p, std::size_t n) { return wyhash(p, n); });
+    auto xx = as_bytes([](const void* p, std::size_t n) { return xxhash64(p, n); });
+    auto fnv = as_bytes([](const void* p, std::size_t n) { return fnv1a64(p, n); });
+    auto std_int = [](std::uint64_t x) -> std::uint64_t { return std::hash<std::uint64_t>{}(x); };
+    auto std_str = as_bytes([](const void* p, std::size_t n) -> std::uint64_t {
+        return std::hash<std::string_view>{}(std::string_view(static_cast<const char*>(p), n));
+    });
+
+    const std::size_t samples = scaled(2'000);
+    const std::size_t n = scaled(1u << 16);
+    const unsigned bits = std::bit_width(n);  // load factor between 0.5 and 1
+
+    // Key sets that trip weak hashes: strided integers and sequential names
+    std::vector<std::uint64_t> strided(n);
+    for (std::size_t i = 0; i < n; ++i) strided[i] = static_cast<std::uint64_t>(i) << 12;
+    std::vector<std::string> name_keys(n);
+    for (std::size_t i = 0; i < n; ++i) name_keys[i] = std::format("user_{:08}", i);
+
+    std::cout << std::format("Avalanche over {} random keys; collisions for {} keys in {} buckets "
+                             "(1.00 = random)\n", samples, n, std::size_t{1} << bits);
+    std::cout << std::format("  {:<22} {:>11} {:>10} {:>14} {:>14}\n",
+                             "hash", "worst bias", "mean bias", "keys i<<12", "\"user_%08d\"");
+
+    auto row = [&](const char* label, auto&& hash64, auto&& string_hash) {
+        auto a = avalanche(hash64, samples);
+        double strided_ratio = bucket_collision_ratio(strided, bits, hash64);
+        std::vector<std::uint64_t> idx(n);
+        for (std::size_t i = 0; i < n; ++i) idx[i] = i;
+        double name_ratio = bucket_collision_ratio(idx, bits, [&](std::uint64_t i) { return string_hash(name_keys[i]); });
+        std::cout << std::format("  {:<22} {:>11.3f} {:>10.4f} {:>14.2f} {:>14.2f}\n",
+                                 label, a.worst_bias, a.mean_bias, strided_ratio, name_ratio);
+    };
+    auto str_of = [](auto byte_hash) {
+        return [byte_hash](const std::string& s) -> std::uint64_t { return byte_hash(s.data(), s.size()); };
+    };
+    auto std_string_hash = [](const std::string& s) -> std::uint64_t { return std::hash<std::string>{}(s); };
+
+    row("std::hash<uint64_t>", std_int, std_string_hash);
+    row("wyhash", wy, str_of([](const void* p, std::size_t k) { return wyhash(p, k); }));
+    row("xxhash64", xx, str_of([](const void* p, std::size_t k) { return xxhash64(p, k); }));
+    row("fnv1a64", fnv, str_of([](const void* p, std::size_t k) { return fnv1a64(p, k); }));
+    row("std::hash<string_view>", std_str, std_string_hash);
+
+    std::cout << "Integer mixers (strings column uses wyhash):\n";
+    auto wy_string = str_of([](const void* p, std::size_t k) { return wyhash(p, k); });
+    row("mix_murmur3", [](std::uint64_t x) { return mix_murmur3(x); }, wy_string);
+    row("mix_splitmix", [](std::uint64_t x) { return mix_splitmix(x); }, wy_string);
+    row("mix_mum", [](std::uint64_t x) { return mix_mum(x); }, wy_string);
+}
+
+// ============================================================================
+// BENCHMARK - Throughput across key lengths, and the effect in a hash map
+// ============================================================================
+void demonstrate_hash_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== HASH THROUGHPUT BENCHMARK ===\n";
+
+    // Keys are consecutive windows of a random buffer that stays in L1/L2
+    constexpr std::size_t buffer_size = 1 << 16;
+    std::vector<std::uint8_t> buffer(buffer_size + 4096);
+    SplitMix64 rng(7);
+    for (auto& b : buffer) b = static_cast<std::uint8_t>(rng.next());
+    const std::size_t bytes_per_run = scaled(32u << 20);
+
+    auto measure = [&](std::size_t len, auto&& byte_hash) {
+        std::size_t count = bytes_per_run / len;
+        std::uint64_t sum = 0;
+        double ms = best_of_ms(3, [&] {
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += byte_hash(buffer.data() + offset, len);
+                offset = (offset + len + 1) & (buffer_size - 1);
+            }
+        });
+        do_not_optimize(sum);
+        double gbps = static_cast<double>(count * len) / (ms * 1e6);
+        return std::format("{:6.2f} GB/s {:5.1f} ns", gbps, ms * 1e6 / static_cast<double>(count));
+    };
+
+    std::cout << std::format("  {:>6}  {:<20} {:<20} {:<20} {:<20}\n", "bytes", "wyhash", "xxhash64", "fnv1a64", "std::hash");
+    for (std::size_t len : {4, 8, 16, 32, 64, 256, 1024, 4096}) {
+        std::cout << std::format("  {:>6}  {:<20} {:<20} {:<20} {:<20}\n", len,
+                                 measure(len, [](const void* p, std::size_t n) { return wyhash(p, n); }),
+                                 measure(len, [](const void* p, std::size_t n) { return xxhash64(p, n); }),
+                                 measure(len, [](const void* p, std::size_t n) { return fnv1a64(p, n); }),
+                                 measure(len, [](const void* p, std::size_t n) -> std::uint64_t {
+                                     return std::hash<std::string_view>{}(
+                                         std::string_view(static_cast<const char*>(p), n));
+                                 }));
+    }
+
+    // libstdc++ uses prime bucket counts, so the difference here is the
+    // string hashing cost rather than bucket distribution
+    const std::size_t n = scaled(200'000);
+    std::vector<std::string> keys(n);
+    for (std::size_t i = 0; i < n; ++i) keys[i] = std::format("/api/v2/users/{:08}/profile", i * 7919);
+
+    auto map_run = [&]<typename Hash>(const char* label) {
+        std::unordered_map<std::string, std::size_t, Hash> map;
+        map.reserve(n);
+        double build_ms = time_ms([&] {
+            for (std::size_t i = 0; i < n; ++i) map.emplace(keys[i], i);
+        });
+        std::size_t sum = 0;
+        double find_ms = best_of_ms(3, [&] {
+            for (const auto& k : keys) sum += map.find(k)->second;
+        });
+        do_not_optimize(sum);
+        print_result(std::format("{} build", label), build_ms, n);
+        print_result(std::format("{} find", label), find_ms, n);
+    };
+    std::cout << std::format("unordered_map<string, size_t> with {} URL keys:\n", n);
+    map_run.template operator()<std::hash<std::string>>("std::hash");
+    map_run.template operator()<fast_hash>("fast_hash");
+}
+
+void run_all_demos() {
+    demonstrate_hash_functions();
+    demonstrate_hash_quality();
+    demonstrate_hash_benchmark();
+}
+
+} // namespace cpp26_hash
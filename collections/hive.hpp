@@ -0,0 +1,443 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <new>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_hive {
+
+// ============================================================================
+// HIVE - Chunked container with stable iterators and O(1) insert/erase
+// Elements never move: erasing leaves a hole that is recorded in a
+// jump-counting skip field, so iteration hops over runs of holes in one
+// step, and later inserts refill holes before growing. Similar in spirit to
+// plf::colony and the proposed std::hive (P0447).
+// Reference: https://en.cppreference.com/w/cpp/container/hive
+// ============================================================================
+template<typename T, std::size_t ChunkCapacity = 256>
+class hive {
+private:
+    static_assert(ChunkCapacity > 1 && ChunkCapacity < 0xFFFF, "chunk indices are 16-bit");
+
+    using index_type = std::uint16_t;
+    static constexpr index_type none = 0xFFFF;
+
+    // Skip field: skip[i] == 0 means slot i is occupied. For a run of erased
+    // slots [s, e], skip[s] == skip[e] == e - s + 1 (the run length), which is
+    // all forward or backward iteration needs. Runs are kept on an intrusive
+    // free list keyed by their first slot so inserts can reuse them in O(1).
+    struct Chunk {
+        alignas(T) std::byte storage[sizeof(T) * ChunkCapacity];
+        index_type skip[ChunkCapacity] = {};
+        index_type free_prev[ChunkCapacity];
+        index_type free_next[ChunkCapacity];
+        index_type free_head = none;
+        index_type high_water = 0;   // Slots at or past this index were never used
+        std::size_t count = 0;
+
+        Chunk* prev = nullptr;
+        Chunk* next = nullptr;
+        Chunk* prev_with_free = nullptr;
+        Chunk* next_with_free = nullptr;
+
+        T* slot(std::size_t i) { return std::launder(reinterpret_cast<T*>(storage) + i); }
+
+        void reset() {
+            std::fill(std::begin(skip), std::end(skip), index_type{0});
+            free_head = none;
+            high_water = 0;
+            count = 0;
+            prev = next = prev_with_free = next_with_free = nullptr;
+        }
+
+        void link_run(index_type start) {
+            free_prev[start] = none;
+            free_next[start] = free_head;
+            if (free_head != none) free_prev[free_head] = start;
+            free_head = start;
+        }
+
+        void unlink_run(index_type start) {
+            if (free_prev[start] != none) free_next[free_prev[start]] = free_next[start];
+            else free_head = free_next[start];
+            if (free_next[start] != none) free_prev[free_next[start]] = free_prev[start];
+        }
+    };
+
+    Chunk* head = nullptr;
+    Chunk* tail = nullptr;
+    Chunk* free_chunks = nullptr;  // Chunks that contain at least one hole
+    Chunk* spare = nullptr;        // One emptied chunk kept to absorb churn
+    std::size_t element_count = 0;
+    std::size_t chunk_count = 0;
+
+    void push_free_chunk(Chunk* c) {
+        c->prev_with_free = nullptr;
+        c->next_with_free = free_chunks;
+        if (free_chunks) free_chunks->prev_with_free = c;
+        free_chunks = c;
+    }
+
+    void remove_free_chunk(Chunk* c) {
+        if (c->prev_with_free) c->prev_with_free->next_with_free = c->next_with_free;
+        else free_chunks = c->next_with_free;
+        if (c->next_with_free) c->next_with_free->prev_with_free = c->prev_with_free;
+        c->prev_with_free = c->next_with_free = nullptr;
+    }
+
+    Chunk* append_chunk() {
+        Chunk* c = spare ? spare : new Chunk;
+        if (spare) {
+            spare = nullptr;
+            c->reset();
+        }
+        c->prev = tail;
+        if (tail) tail->next = c;
+        else head = c;
+        tail = c;
+        ++chunk_count;
+        return c;
+    }
+
+    void remove_chunk(Chunk* c) {
+        if (c->free_head != none) remove_free_chunk(c);
+        if (c->prev) c->prev->next = c->next;
+        else head = c->next;
+        if (c->next) c->next->prev = c->prev;
+        else tail = c->prev;
+        --chunk_count;
+        if (spare) delete spare;
+        spare = c;
+    }
+
+    // Picks the slot for a new element and updates the skip field
+    std::pair<Chunk*, index_type> acquire_slot() {
+        if (free_chunks) {
+            // Reuse the first slot of a hole run: the run shrinks from the front
+            Chunk* c = free_chunks;
+            index_type s = c->free_head;
+            index_type length = c->skip[s];
+            c->unlink_run(s);
+            c->skip[s] = 0;
+            if (length > 1) {
+                index_type next_start = s + 1;
+                c->skip[next_start] = length - 1;
+                c->skip[s + length - 1] = length - 1;
+                c->link_run(next_start);
+            }
+            if (c->free_head == none) remove_free_chunk(c);
+            return {c, s};
+        }
+        Chunk* c = (tail && tail->high_water < ChunkCapacity) ? tail : append_chunk();
+        return {c, c->high_water++};
+    }
+
+    // Marks slot i as a hole, merging with neighbouring hole runs
+    void release_slot(Chunk* c, index_type i) {
+        bool had_free = c->free_head != none;
+        index_type left = (i > 0) ? c->skip[i - 1] : 0;
+        index_type right = (i + 1 < c->high_water) ? c->skip[i + 1] : 0;
+
+        if (left == 0 && right == 0) {
+            c->skip[i] = 1;
+            c->link_run(i);
+        } else if (right == 0) {
+            index_type start = i - left;
+            c->skip[start] = c->skip[i] = left + 1;
+        } else if (left == 0) {
+            c->unlink_run(i + 1);
+            c->skip[i] = c->skip[i + right] = right + 1;
+            c->link_run(i);
+        } else {
+            c->unlink_run(i + 1);
+            index_type start = i - left;
+            c->skip[start] = c->skip[i + right] = left + right + 1;
+        }
+
+        if (!had_free) push_free_chunk(c);
+    }
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class hive;
+        template<bool> friend class basic_iterator;
+        const hive* owner = nullptr;  // Only for stepping back from end()
+        Chunk* chunk = nullptr;
+        std::size_t index = 0;
+
+        basic_iterator(const hive* h, Chunk* c, std::size_t i) : owner(h), chunk(c), index(i) {}
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(owner, chunk, index); }
+
+        reference operator*() const { return *chunk->slot(index); }
+        pointer operator->() const { return chunk->slot(index); }
+
+        // O(1): a hole run is crossed with a single skip-field read
+        basic_iterator& operator++() {
+            ++index;
+            if (index < chunk->high_water) index += chunk->skip[index];
+            if (index >= chunk->high_water) {
+                chunk = chunk->next;
+                index = chunk ? chunk->skip[0] : 0;  // Chunks are never empty
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        // O(1) as well: the slot before a hole run holds its length too
+        basic_iterator& operator--() {
+            if (!chunk) {
+                chunk = owner->tail;
+                index = chunk->high_water;
+            }
+            if (index == 0 || chunk->skip[index - 1] >= index) {
+                chunk = chunk->prev;
+                index = chunk->high_water;
+            }
+            index -= chunk->skip[index - 1] + 1;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const basic_iterator& other) const {
+            return chunk == other.chunk && index == other.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    hive() = default;
+
+    hive(std::initializer_list<T> init) {
+        for (const auto& x : init) insert(x);
+    }
+
+    hive(const hive&) = delete;
+    hive& operator=(const hive&) = delete;
+
+    ~hive() {
+        clear();
+        delete spare;
+    }
+
+    iterator begin() { return head ? iterator(this, head, head->skip[0]) : end(); }
+    iterator end() { return iterator(this, nullptr, 0); }
+    const_iterator begin() const { return head ? const_iterator(this, head, head->skip[0]) : end(); }
+    const_iterator end() const { return const_iterator(this, nullptr, 0); }
+
+    std::size_t size() const { return element_count; }
+    bool empty() const { return element_count == 0; }
+    std::size_t chunks() const { return chunk_count; }
+    std::size_t capacity() const { return chunk_count * ChunkCapacity; }
+
+    template<typename... Args>
+    iterator emplace(Args&&... args) {
+        auto [c, i] = acquire_slot();
+        ::new (static_cast<void*>(c->slot(i))) T(std::forward<Args>(args)...);
+        ++c->count;
+        ++element_count;
+        return iterator(this, c, i);
+    }
+
+    iterator insert(const T& value) { return emplace(value); }
+    iterator insert(T&& value) { return emplace(std::move(value)); }
+
+    // Erases one element in O(1); every other iterator stays valid
+    iterator erase(const_iterator pos) {
+        Chunk* c = pos.chunk;
+        index_type i = static_cast<index_type>(pos.index);
+        iterator next(this, c, i);
+        ++next;
+
+        std::destroy_at(c->slot(i));
+        --element_count;
+        if (--c->count == 0) {
+            remove_chunk(c);  // next already points past this chunk
+        } else {
+            release_slot(c, i);
+        }
+        return next;
+    }
+
+    void clear() {
+        for (auto it = begin(); it != end(); ++it) std::destroy_at(&*it);
+        while (head) {
+            Chunk* next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = free_chunks = nullptr;
+        element_count = chunk_count = 0;
+    }
+};
+
+void demonstrate_hive() {
+    std::cout << "\n=== HIVE (Stable Iterators, O(1) Erase) ===\n";
+
+    hive<int, 8> h;
+    std::vector<hive<int, 8>::iterator> handles;
+    for (int i = 0; i < 20; ++i) handles.push_back(h.insert(i));
+
+    auto print = [&h](const char* label) {
+        std::cout << label;
+        for (int x : h) std::cout << x << " ";
+        std::cout << std::format(" (size={}, chunks={})\n", h.size(), h.chunks());
+    };
+    print("Initial: ");
+
+    // Erase every third element through stored iterators
+    for (std::size_t i = 0; i < handles.size(); i += 3) h.erase(handles[i]);
+    print("After erasing every 3rd: ");
+
+    // Untouched iterators still point at the same elements
+    std::cout << std::format("handles[4] still -> {}, handles[10] still -> {}\n",
+                             *handles[4], *handles[10]);
+
+    // Erase a contiguous run; iteration jumps over it in one step
+    for (std::size_t i = 4; i <= 7; ++i) {
+        if (i % 3 != 0) h.erase(handles[i]);
+    }
+    print("After erasing 4..7: ");
+
+    // Backward iteration reads the run length at the other end of each hole
+    std::cout << "Backward: ";
+    for (auto it = h.end(); it != h.begin();) std::cout << *--it << " ";
+    std::cout << "\n";
+
+    // New elements refill holes before new chunks are allocated
+    for (int i = 100; i < 105; ++i) h.insert(i);
+    print("After inserting 100..104: ");
+
+    // erase() returns the next element, like std containers
+    int erased = 0;
+    for (auto it = h.begin(); it != h.end();) {
+        if (*it >= 100) {
+            it = h.erase(it);
+            ++erased;
+        } else {
+            ++it;
+        }
+    }
+    std::cout << std::format("Erased {} values >= 100 while iterating\n", erased);
+    print("Final: ");
+}
+
+// ============================================================================
+// HIVE BENCHMARK - Entity churn and iteration vs vector and list
+// ============================================================================
+void demonstrate_hive_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== HIVE BENCHMARK (Entity Churn + Iteration) ===\n";
+
+    struct Entity {
+        float x, y, vx, vy;
+    };
+
+    const std::size_t n = scaled(100'000);
+    const std::size_t churn = n / 100;   // 1% of entities replaced per frame
+    const int frames = 5;
+    std::cout << std::format("{} entities, {} replaced per frame, {} frames\n", n, churn, frames);
+
+    auto make = [](std::size_t i) {
+        float f = static_cast<float>(i);
+        return Entity{f, f * 0.5f, 1.0f, -1.0f};
+    };
+
+    // std::vector: erase from the middle shifts the tail (O(n))
+    {
+        SplitMix64 rng;
+        std::vector<Entity> v;
+        for (std::size_t i = 0; i < n; ++i) v.push_back(make(i));
+        double churn_ms = 0, iterate_ms = 0;
+        for (int f = 0; f < frames; ++f) {
+            churn_ms += time_ms([&] {
+                for (std::size_t k = 0; k < churn; ++k) {
+                    v.erase(v.begin() + static_cast<std::ptrdiff_t>(rng.next() % v.size()));
+                    v.push_back(make(k));
+                }
+            });
+            iterate_ms += time_ms([&] {
+                float sum = 0;
+                for (const auto& e : v) sum += e.x;
+                do_not_optimize(sum);
+            });
+        }
+        print_result("vector  churn (erase middle)", churn_ms, churn * frames);
+        print_result("vector  iterate", iterate_ms, n * frames);
+    }
+
+    // std::list and hive: erase through stored iterators (O(1))
+    auto run_handles = [&](auto& container, const char* churn_label, const char* iterate_label) {
+        SplitMix64 rng;
+        std::vector<decltype(container.begin())> handles;
+        for (std::size_t i = 0; i < n; ++i) handles.push_back(container.insert(container.end(), make(i)));
+        double churn_ms = 0, iterate_ms = 0;
+        for (int f = 0; f < frames; ++f) {
+            churn_ms += time_ms([&] {
+                for (std::size_t k = 0; k < churn; ++k) {
+                    std::size_t victim = rng.next() % handles.size();
+                    container.erase(handles[victim]);
+                    handles[victim] = container.insert(container.end(), make(k));
+                }
+            });
+            iterate_ms += time_ms([&] {
+                float sum = 0;
+                for (const auto& e : container) sum += e.x;
+                do_not_optimize(sum);
+            });
+        }
+        print_result(churn_label, churn_ms, churn * frames);
+        print_result(iterate_label, iterate_ms, n * frames);
+    };
+
+    std::list<Entity> lst;
+    run_handles(lst, "list    churn", "list    iterate");
+
+    // Adapter so hive matches the insert(pos, value) shape used above
+    struct HiveAdapter {
+        hive<Entity> h;
+        auto begin() { return h.begin(); }
+        auto end() { return h.end(); }
+        auto insert(hive<Entity>::iterator, const Entity& e) { return h.insert(e); }
+        void erase(hive<Entity>::iterator it) { h.erase(it); }
+    } hv;
+    run_handles(hv, "hive    churn", "hive    iterate");
+}
+
+void run_all_demos() {
+    demonstrate_hive();
+    demonstrate_hive_benchmark();
+}
+
+} // namespace cpp26_hive
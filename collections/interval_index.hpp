@@ -0,0 +1,448 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <span>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_interval {
+
+// Closed interval [lo, hi] carrying a payload
+template<typename T, typename V>
+struct interval {
+    T lo;
+    T hi;
+    V value;
+};
+
+// ============================================================================
+// STATIC INTERVAL INDEX - Implicit interval tree over a sorted array
+// (after Heng Li's cgranges)
+// Intervals are sorted by lo and the array itself is read as a complete
+// binary tree: node i sits at level = trailing ones of i, leaves at even
+// indices. Each node also stores the max hi of its subtree, so a query
+// skips any subtree that ends before the point. Everything lives in one
+// contiguous vector - no pointers, one allocation.
+// ============================================================================
+template<typename T, typename V>
+class static_interval_index {
+private:
+    struct entry {
+        T lo;
+        T hi;
+        T max_hi;  // Max hi over the implicit subtree rooted here
+        V value;
+    };
+
+    std::vector<entry> entries;
+    int max_level = 0;
+
+    void index() {
+        std::ranges::sort(entries, [](const entry& a, const entry& b) {
+            return a.lo < b.lo || (a.lo == b.lo && a.hi < b.hi);
+        });
+        const std::size_t n = entries.size();
+        if (n == 0) {
+            max_level = 0;
+            return;
+        }
+
+        std::size_t last_i = 0;
+        T last{};
+        for (std::size_t i = 0; i < n; i += 2) {
+            last_i = i;
+            last = entries[i].max_hi = entries[i].hi;
+        }
+        int k = 1;
+        for (; (std::size_t{1} << k) <= n; ++k) {
+            const std::size_t x = std::size_t{1} << (k - 1), step = x << 2;
+            for (std::size_t i = (x << 1) - 1; i < n; i += step) {
+                // A missing right subtree inherits the max of the last real node
+                T right = i + x < n ? entries[i + x].max_hi : last;
+                entries[i].max_hi = std::max({entries[i].hi, entries[i - x].max_hi, right});
+            }
+            last_i = (last_i >> k & 1) ? last_i - x : last_i + x;
+            if (last_i < n && entries[last_i].max_hi > last) last = entries[last_i].max_hi;
+        }
+        max_level = k - 1;
+    }
+
+public:
+    static_interval_index() = default;
+
+    explicit static_interval_index(std::span<const interval<T, V>> items) {
+        entries.reserve(items.size());
+        for (const auto& it : items) {
+            if (it.hi < it.lo) throw std::invalid_argument("interval with hi < lo");
+            entries.push_back({it.lo, it.hi, it.hi, it.value});
+        }
+        index();
+    }
+
+    std::size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    // Calls f(lo, hi, value) for every interval intersecting [a, b]
+    template<typename F>
+    void for_each_overlapping(T a, T b, F f) const {
+        const std::size_t n = entries.size();
+        if (n == 0) return;
+
+        struct frame {
+            std::size_t x;
+            int k;
+            bool left_done;
+        };
+        frame stack[128];
+        int top = 0;
+        stack[top++] = {(std::size_t{1} << max_level) - 1, max_level, false};
+
+        while (top) {
+            frame z = stack[--top];
+            if (z.k <= 3) {
+                // Small subtree: a linear scan beats further descent
+                std::size_t i0 = z.x >> z.k << z.k;
+                std::size_t i1 = std::min(i0 + (std::size_t{1} << (z.k + 1)) - 1, n);
+                for (std::size_t i = i0; i < i1 && entries[i].lo <= b; ++i)
+                    if (a <= entries[i].hi) f(entries[i].lo, entries[i].hi, entries[i].value);
+            } else if (!z.left_done) {
+                std::size_t y = z.x - (std::size_t{1} << (z.k - 1));
+                stack[top++] = {z.x, z.k, true};
+                // y may be past the end; its subtree can still hold real nodes
+                if (y >= n || entries[y].max_hi >= a) stack[top++] = {y, z.k - 1, false};
+            } else if (z.x < n && entries[z.x].lo <= b) {
+                if (a <= entries[z.x].hi) f(entries[z.x].lo, entries[z.x].hi, entries[z.x].value);
+                stack[top++] = {z.x + (std::size_t{1} << (z.k - 1)), z.k - 1, false};
+            }
+        }
+    }
+
+    // Calls f(lo, hi, value) for every interval containing x
+    template<typename F>
+    void for_each_stab(T x, F f) const { for_each_overlapping(x, x, f); }
+
+    std::vector<V> stab(T x) const {
+        std::vector<V> out;
+        for_each_stab(x, [&](T, T, const V& v) { out.push_back(v); });
+        return out;
+    }
+
+    // Answers a batch of ascending query points in one sweep over the
+    // lo-sorted array: intervals join an active list when lo passes the
+    // query and leave it once hi falls behind. Total cost is
+    // O(n + queries + matches). Calls f(query_index, lo, hi, value).
+    template<typename F>
+    void stab_sorted(std::span<const T> queries, F f) const {
+        if (!std::ranges::is_sorted(queries))
+            throw std::invalid_argument("stab_sorted requires ascending queries");
+
+        std::vector<std::size_t> active;
+        std::size_t next = 0;
+        for (std::size_t q = 0; q < queries.size(); ++q) {
+            const T x = queries[q];
+            while (next < entries.size() && entries[next].lo <= x) active.push_back(next++);
+            std::size_t kept = 0;
+            for (std::size_t idx : active) {
+                const entry& e = entries[idx];
+                if (e.hi < x) continue;  // Expired for this and every later query
+                active[kept++] = idx;
+                f(q, e.lo, e.hi, e.value);
+            }
+            active.resize(kept);
+        }
+    }
+};
+
+// ============================================================================
+// DYNAMIC INTERVAL TREE - Treap keyed by (lo, hi) augmented with subtree max
+// Supports insert/erase between queries at O(log n) expected cost. Nodes live
+// in one pooled vector addressed by 32-bit indices with a free list.
+// ============================================================================
+template<typename T, typename V>
+class interval_tree {
+private:
+    static constexpr std::uint32_t null = UINT32_MAX;
+
+    struct Node {
+        T lo;
+        T hi;
+        T max_hi;
+        V value;
+        std::uint64_t priority;
+        std::uint32_t left = null;
+        std::uint32_t right = null;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> free_list;
+    std::uint32_t root = null;
+    std::size_t element_count = 0;
+    cpp26_benchmark::SplitMix64 rng{0x1badb002};
+
+    static bool key_less(T alo, T ahi, T blo, T bhi) { return alo < blo || (alo == blo && ahi < bhi); }
+
+    void update(std::uint32_t i) {
+        Node& n = nodes[i];
+        n.max_hi = n.hi;
+        if (n.left != null) n.max_hi = std::max(n.max_hi, nodes[n.left].max_hi);
+        if (n.right != null) n.max_hi = std::max(n.max_hi, nodes[n.right].max_hi);
+    }
+
+    std::uint32_t rotate_right(std::uint32_t i) {
+        std::uint32_t l = nodes[i].left;
+        nodes[i].left = nodes[l].right;
+        nodes[l].right = i;
+        update(i);
+        update(l);
+        return l;
+    }
+
+    std::uint32_t rotate_left(std::uint32_t i) {
+        std::uint32_t r = nodes[i].right;
+        nodes[i].right = nodes[r].left;
+        nodes[r].left = i;
+        update(i);
+        update(r);
+        return r;
+    }
+
+    std::uint32_t insert_at(std::uint32_t i, std::uint32_t fresh) {
+        if (i == null) return fresh;
+        if (key_less(nodes[fresh].lo, nodes[fresh].hi, nodes[i].lo, nodes[i].hi)) {
+            nodes[i].left = insert_at(nodes[i].left, fresh);
+            if (nodes[nodes[i].left].priority > nodes[i].priority) return rotate_right(i);
+        } else {
+            nodes[i].right = insert_at(nodes[i].right, fresh);
+            if (nodes[nodes[i].right].priority > nodes[i].priority) return rotate_left(i);
+        }
+        update(i);
+        return i;
+    }
+
+    // Joins two treaps where every key in a precedes every key in b
+    std::uint32_t merge(std::uint32_t a, std::uint32_t b) {
+        if (a == null) return b;
+        if (b == null) return a;
+        if (nodes[a].priority > nodes[b].priority) {
+            nodes[a].right = merge(nodes[a].right, b);
+            update(a);
+            return a;
+        }
+        nodes[b].left = merge(a, nodes[b].left);
+        update(b);
+        return b;
+    }
+
+    std::uint32_t erase_at(std::uint32_t i, const interval<T, V>& item, bool& erased) {
+        if (i == null) return null;
+        Node& n = nodes[i];
+        if (key_less(item.lo, item.hi, n.lo, n.hi)) {
+            n.left = erase_at(n.left, item, erased);
+        } else if (key_less(n.lo, n.hi, item.lo, item.hi)) {
+            n.right = erase_at(n.right, item, erased);
+        } else if (n.value == item.value) {
+            erased = true;
+            std::uint32_t joined = merge(n.left, n.right);
+            free_list.push_back(i);
+            return joined;
+        } else {
+            // Equal (lo, hi) runs may straddle this node after rotations
+            n.left = erase_at(n.left, item, erased);
+            if (!erased) n.right = erase_at(n.right, item, erased);
+        }
+        update(i);
+        return i;
+    }
+
+    template<typename F>
+    void overlap_at(std::uint32_t i, T a, T b, F& f) const {
+        while (i != null) {
+            const Node& n = nodes[i];
+            if (n.max_hi < a) return;  // Nothing below reaches a
+            overlap_at(n.left, a, b, f);
+            if (b < n.lo) return;  // n and its right subtree start after b
+            if (a <= n.hi) f(n.lo, n.hi, n.value);
+            i = n.right;
+        }
+    }
+
+public:
+    std::size_t size() const { return element_count; }
+    bool empty() const { return element_count == 0; }
+
+    void reserve(std::size_t n) { nodes.reserve(n); }
+
+    void insert(T lo, T hi, V value) {
+        if (hi < lo) throw std::invalid_argument("interval with hi < lo");
+        std::uint32_t fresh;
+        Node node{lo, hi, hi, std::move(value), rng.next()};
+        if (!free_list.empty()) {
+            fresh = free_list.back();
+            free_list.pop_back();
+            nodes[fresh] = std::move(node);
+        } else {
+            fresh = static_cast<std::uint32_t>(nodes.size());
+            nodes.push_back(std::move(node));
+        }
+        root = insert_at(root, fresh);
+        ++element_count;
+    }
+
+    // Removes one interval equal to [lo, hi] with the given value
+    bool erase(T lo, T hi, const V& value) {
+        bool erased = false;
+        root = erase_at(root, interval<T, V>{lo, hi, value}, erased);
+        element_count -= erased;
+        return erased;
+    }
+
+    // Calls f(lo, hi, value) for every interval intersecting [a, b], ordered by lo
+    template<typename F>
+    void for_each_overlapping(T a, T b, F f) const { overlap_at(root, a, b, f); }
+
+    template<typename F>
+    void for_each_stab(T x, F f) const { overlap_at(root, x, x, f); }
+
+    std::vector<V> stab(T x) const {
+        std::vector<V> out;
+        for_each_stab(x, [&](T, T, const V& v) { out.push_back(v); });
+        return out;
+    }
+};
+
+void demonstrate_interval_index() {
+    std::cout << "\n=== INTERVAL INDEX ===\n";
+
+    // The ranges from cpp26_set::demonstrate_set_pairs, plus overlapping ones
+    std::vector<interval<int, char>> ranges = {
+        {2, 3, 'a'}, {4, 5, 'b'}, {7, 9, 'c'}, {10, 15, 'd'}, {1, 8, 'e'}, {8, 12, 'f'},
+    };
+    static_interval_index<int, char> index(ranges);
+
+    std::cout << "Ranges: ";
+    for (const auto& r : ranges) std::cout << std::format("{}=[{}, {}] ", r.value, r.lo, r.hi);
+    std::cout << "\n";
+
+    for (int x : {3, 6, 8, 12, 16}) {
+        std::cout << std::format("{:>2} is in:", x);
+        index.for_each_stab(x, [](int lo, int hi, char v) { std::cout << std::format(" {}=[{}, {}]", v, lo, hi); });
+        std::cout << "\n";
+    }
+
+    std::vector<int> batch = {0, 2, 5, 8, 9, 13};
+    std::vector<std::size_t> hits(batch.size());
+    index.stab_sorted(batch, [&](std::size_t q, int, int, char) { ++hits[q]; });
+    std::cout << "Sorted batch (query:matches):";
+    for (std::size_t q = 0; q < batch.size(); ++q) std::cout << std::format(" {}:{}", batch[q], hits[q]);
+    std::cout << "\n";
+
+    interval_tree<int, char> tree;
+    for (const auto& r : ranges) tree.insert(r.lo, r.hi, r.value);
+    tree.erase(1, 8, 'e');
+    tree.insert(6, 6, 'g');
+    std::cout << "Dynamic tree after erase e, insert g=[6, 6]; overlapping [5, 7]:";
+    tree.for_each_overlapping(5, 7, [](int lo, int hi, char v) { std::cout << std::format(" {}=[{}, {}]", v, lo, hi); });
+    std::cout << "\n";
+}
+
+// ============================================================================
+// BENCHMARK - IP-range (disjoint) and time-window (overlapping) stabbing
+// ============================================================================
+void demonstrate_interval_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== INTERVAL INDEX BENCHMARK ===\n";
+
+    const std::size_t n = scaled(100'000);
+    const std::size_t q = scaled(1 << 20);
+    SplitMix64 rng(42);
+
+    std::vector<std::uint32_t> queries(q);
+    for (auto& x : queries) x = static_cast<std::uint32_t>(rng.next());
+    std::vector<std::uint32_t> sorted_queries = queries;
+    std::ranges::sort(sorted_queries);
+
+    // Disjoint IP ranges: the case std::set<pair>::upper_bound can handle
+    {
+        std::vector<std::uint32_t> cuts(2 * n);
+        for (auto& c : cuts) c = static_cast<std::uint32_t>(rng.next());
+        std::ranges::sort(cuts);
+        std::vector<interval<std::uint32_t, std::uint32_t>> ranges;
+        std::set<std::pair<std::uint32_t, std::uint32_t>> set;
+        for (std::size_t i = 0; i + 1 < cuts.size(); i += 2) {
+            ranges.push_back({cuts[i], cuts[i + 1], static_cast<std::uint32_t>(i / 2)});
+            set.insert({cuts[i], cuts[i + 1]});
+        }
+        static_interval_index<std::uint32_t, std::uint32_t> index(ranges);
+
+        std::cout << std::format("{} disjoint IP ranges, {} lookups:\n", ranges.size(), q);
+        std::size_t set_hits = 0, index_hits = 0, batch_hits = 0;
+        print_result("set<pair>::upper_bound", best_of_ms(3, [&] {
+            set_hits = 0;
+            for (auto x : queries) {
+                auto it = set.upper_bound({x, UINT32_MAX});
+                if (it != set.begin() && x <= (--it)->second) ++set_hits;
+            }
+        }), q);
+        print_result("static index stab", best_of_ms(3, [&] {
+            index_hits = 0;
+            for (auto x : queries) index.for_each_stab(x, [&](auto, auto, auto) { ++index_hits; });
+        }), q);
+        print_result("static index stab_sorted", best_of_ms(3, [&] {
+            batch_hits = 0;
+            index.stab_sorted(sorted_queries, [&](std::size_t, auto, auto, auto) { ++batch_hits; });
+        }), q);
+        std::cout << std::format("  matches: {} / {} / {}\n", set_hits, index_hits, batch_hits);
+    }
+
+    // Overlapping time windows: upper_bound would miss all but one match
+    {
+        std::vector<interval<std::uint32_t, std::uint32_t>> windows(n);
+        interval_tree<std::uint32_t, std::uint32_t> tree;
+        tree.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            auto lo = static_cast<std::uint32_t>(rng.next());
+            std::uint32_t len = static_cast<std::uint32_t>(rng.next() % (UINT32_MAX / n * 8));
+            std::uint32_t hi = lo > UINT32_MAX - len ? UINT32_MAX : lo + len;
+            windows[i] = {lo, hi, static_cast<std::uint32_t>(i)};
+        }
+        std::cout << std::format("{} overlapping windows, {} stabbing queries:\n", n, q);
+
+        static_interval_index<std::uint32_t, std::uint32_t> index;
+        print_result("static index build", time_ms([&] { index = static_interval_index<std::uint32_t, std::uint32_t>(windows); }), n);
+        print_result("interval_tree insert", time_ms([&] {
+            for (const auto& w : windows) tree.insert(w.lo, w.hi, w.value);
+        }), n);
+
+        std::size_t index_hits = 0, tree_hits = 0, batch_hits = 0;
+        print_result("static index stab", best_of_ms(3, [&] {
+            index_hits = 0;
+            for (auto x : queries) index.for_each_stab(x, [&](auto, auto, auto) { ++index_hits; });
+        }), q);
+        print_result("interval_tree stab", best_of_ms(3, [&] {
+            tree_hits = 0;
+            for (auto x : queries) tree.for_each_stab(x, [&](auto, auto, auto) { ++tree_hits; });
+        }), q);
+        print_result("static index stab_sorted", best_of_ms(3, [&] {
+            batch_hits = 0;
+            index.stab_sorted(sorted_queries, [&](std::size_t, auto, auto, auto) { ++batch_hits; });
+        }), q);
+        std::cout << std::format("  matches: {} / {} / {} (avg {:.2f} per query)\n", index_hits, tree_hits,
+                                 batch_hits, static_cast<double>(batch_hits) / q);
+    }
+}
+
+void run_all_demos() {
+    demonstrate_interval_index();
+    demonstrate_interval_benchmark();
+}
+
+} // namespace cpp26_interval
@@ -0,0 +1,529 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <list>
+#include <memory>
+#include <string>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_intrusive {
+
+// ============================================================================
+// HOOKS - Link fields that live inside the element
+// An element derives from one hook per list it can join; the Tag type tells
+// the hooks apart, so one object can sit in an LRU list and a timer list at
+// the same time without any extra allocation.
+// ============================================================================
+template<typename Tag = void>
+class list_hook {
+private:
+    template<typename, typename> friend class intrusive_list;
+    list_hook* prev = nullptr;
+    list_hook* next = nullptr;
+
+public:
+    list_hook() = default;
+    // Copying an element must not copy its list membership
+    list_hook(const list_hook&) {}
+    list_hook& operator=(const list_hook&) { return *this; }
+
+    bool is_linked() const { return next != nullptr; }
+};
+
+template<typename Tag = void>
+class slist_hook {
+private:
+    template<typename, typename> friend class intrusive_slist;
+    slist_hook* next = nullptr;
+    bool linked = false;
+
+public:
+    slist_hook() = default;
+    slist_hook(const slist_hook&) {}
+    slist_hook& operator=(const slist_hook&) { return *this; }
+
+    bool is_linked() const { return linked; }
+};
+
+// ============================================================================
+// INTRUSIVE_LIST - Circular doubly-linked list over list_hook<Tag>
+// The list never allocates: push/erase/splice only rewire pointers, and
+// erase(element) is O(1) because the element carries its own links.
+// Elements must outlive their membership (erase before destroying them).
+// ============================================================================
+template<typename T, typename Tag = void>
+class intrusive_list {
+private:
+    using hook_type = list_hook<Tag>;
+    static_assert(std::is_base_of_v<hook_type, T>, "T must derive from list_hook<Tag>");
+
+    hook_type sentinel;
+    std::size_t count = 0;
+
+    static T& owner(hook_type* h) { return static_cast<T&>(*h); }
+    static hook_type* hook_of(T& value) { return static_cast<hook_type*>(&value); }
+
+    void link_before(hook_type* pos, hook_type* h) {
+        if (h->is_linked()) throw std::logic_error("intrusive_list: element is already linked");
+        h->prev = pos->prev;
+        h->next = pos;
+        pos->prev->next = h;
+        pos->prev = h;
+        ++count;
+    }
+
+    void unlink(hook_type* h) {
+        h->prev->next = h->next;
+        h->next->prev = h->prev;
+        h->prev = h->next = nullptr;
+        --count;
+    }
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class intrusive_list;
+        template<bool> friend class basic_iterator;
+        hook_type* node = nullptr;
+
+        explicit basic_iterator(hook_type* h) : node(h) {}
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(node); }
+
+        reference operator*() const { return owner(node); }
+        pointer operator->() const { return &owner(node); }
+
+        basic_iterator& operator++() { node = node->next; return *this; }
+        basic_iterator& operator--() { node = node->prev; return *this; }
+        basic_iterator operator++(int) { auto tmp = *this; node = node->next; return tmp; }
+        basic_iterator operator--(int) { auto tmp = *this; node = node->prev; return tmp; }
+
+        bool operator==(const basic_iterator& other) const { return node == other.node; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    intrusive_list() { sentinel.prev = sentinel.next = &sentinel; }
+
+    // The sentinel is self-referential, so lists are neither copied nor moved
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    ~intrusive_list() { clear(); }
+
+    iterator begin() { return iterator(sentinel.next); }
+    iterator end() { return iterator(&sentinel); }
+    const_iterator begin() const { return const_iterator(sentinel.next); }
+    const_iterator end() const { return const_iterator(const_cast<hook_type*>(&sentinel)); }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    T& front() { return owner(sentinel.next); }
+    T& back() { return owner(sentinel.prev); }
+
+    void push_front(T& value) { link_before(sentinel.next, hook_of(value)); }
+    void push_back(T& value) { link_before(&sentinel, hook_of(value)); }
+    iterator insert(const_iterator pos, T& value) {
+        link_before(pos.node, hook_of(value));
+        return iterator(hook_of(value));
+    }
+
+    void pop_front() { unlink(sentinel.next); }
+    void pop_back() { unlink(sentinel.prev); }
+
+    // O(1) removal straight from the element
+    void erase(T& value) { unlink(hook_of(value)); }
+
+    iterator erase(const_iterator pos) {
+        hook_type* next = pos.node->next;
+        unlink(pos.node);
+        return iterator(next);
+    }
+
+    // The LRU "touch": relink an element at the front without allocating
+    void move_to_front(T& value) {
+        hook_type* h = hook_of(value);
+        if (sentinel.next == h) return;
+        unlink(h);
+        link_before(sentinel.next, h);
+    }
+
+    // Transfers every element of other before pos in O(1)
+    void splice(const_iterator pos, intrusive_list& other) {
+        if (other.empty()) return;
+        hook_type* first = other.sentinel.next;
+        hook_type* last = other.sentinel.prev;
+        other.sentinel.prev = other.sentinel.next = &other.sentinel;
+
+        first->prev = pos.node->prev;
+        last->next = pos.node;
+        pos.node->prev->next = first;
+        pos.node->prev = last;
+        count += other.count;
+        other.count = 0;
+    }
+
+    template<typename Pred>
+    std::size_t remove_if(Pred pred) {
+        std::size_t removed = 0;
+        for (auto it = begin(); it != end();) {
+            if (pred(*it)) {
+                it = erase(it);
+                ++removed;
+            } else {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    void clear() {
+        while (!empty()) pop_front();
+    }
+
+    static iterator iterator_to(T& value) { return iterator(hook_of(value)); }
+};
+
+// ============================================================================
+// INTRUSIVE_SLIST - Singly-linked stack/queue over slist_hook<Tag>
+// One pointer per element; a tail pointer makes push_back O(1) for FIFOs.
+// ============================================================================
+template<typename T, typename Tag = void>
+class intrusive_slist {
+private:
+    using hook_type = slist_hook<Tag>;
+    static_assert(std::is_base_of_v<hook_type, T>, "T must derive from slist_hook<Tag>");
+
+    hook_type* head = nullptr;
+    hook_type* tail = nullptr;
+    std::size_t count = 0;
+
+    static T& owner(hook_type* h) { return static_cast<T&>(*h); }
+
+    static hook_type* claim(T& value) {
+        hook_type* h = static_cast<hook_type*>(&value);
+        if (h->linked) throw std::logic_error("intrusive_slist: element is already linked");
+        h->linked = true;
+        return h;
+    }
+
+public:
+    class iterator {
+    private:
+        friend class intrusive_slist;
+        hook_type* node = nullptr;
+
+        explicit iterator(hook_type* h) : node(h) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+        T& operator*() const { return owner(node); }
+        T* operator->() const { return &owner(node); }
+        iterator& operator++() { node = node->next; return *this; }
+        iterator operator++(int) { auto tmp = *this; node = node->next; return tmp; }
+        bool operator==(const iterator& other) const { return node == other.node; }
+    };
+
+    intrusive_slist() = default;
+    intrusive_slist(const intrusive_slist&) = delete;
+    intrusive_slist& operator=(const intrusive_slist&) = delete;
+    ~intrusive_slist() { clear(); }
+
+    iterator begin() const { return iterator(head); }
+    iterator end() const { return iterator(nullptr); }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return head == nullptr; }
+    T& front() { return owner(head); }
+
+    void push_front(T& value) {
+        hook_type* h = claim(value);
+        h->next = head;
+        head = h;
+        if (!tail) tail = h;
+        ++count;
+    }
+
+    void push_back(T& value) {
+        hook_type* h = claim(value);
+        h->next = nullptr;
+        (tail ? tail->next : head) = h;
+        tail = h;
+        ++count;
+    }
+
+    void pop_front() {
+        hook_type* h = head;
+        head = h->next;
+        if (!head) tail = nullptr;
+        h->next = nullptr;
+        h->linked = false;
+        --count;
+    }
+
+    void clear() {
+        while (!empty()) pop_front();
+    }
+};
+
+// ============================================================================
+// OBJECT_POOL - Fixed-size slot allocator for list elements
+// Slots come from BlockSize-sized blocks and are recycled through a free
+// list, so after reserve() create/destroy never touch the global heap.
+// Live objects must be destroyed before the pool goes away.
+// ============================================================================
+template<typename T, std::size_t BlockSize = 256>
+class object_pool {
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+    Slot* free_list = nullptr;
+    std::size_t live = 0;
+
+    void grow() {
+        auto block = std::make_unique<Slot[]>(BlockSize);
+        for (std::size_t i = BlockSize; i-- > 0;) {
+            block[i].next = free_list;
+            free_list = &block[i];
+        }
+        blocks.push_back(std::move(block));
+    }
+
+public:
+    object_pool() = default;
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+
+    template<typename... Args>
+    T* create(Args&&... args) {
+        if (!free_list) grow();
+        Slot* slot = free_list;
+        free_list = slot->next;
+        try {
+            T* obj = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            ++live;
+            return obj;
+        } catch (...) {
+            slot->next = free_list;
+            free_list = slot;
+            throw;
+        }
+    }
+
+    void destroy(T* obj) {
+        obj->~T();
+        auto* slot = reinterpret_cast<Slot*>(obj);
+        slot->next = free_list;
+        free_list = slot;
+        --live;
+    }
+
+    void reserve(std::size_t n) {
+        while (capacity() < n) grow();
+    }
+
+    std::size_t size() const { return live; }
+    std::size_t capacity() const { return blocks.size() * BlockSize; }
+    std::size_t block_count() const { return blocks.size(); }
+};
+
+void demonstrate_intrusive_list() {
+    std::cout << "\n=== INTRUSIVE LIST ===\n";
+
+    // A cache entry that is in the LRU order and the expiry order at once
+    struct LruTag {};
+    struct TimerTag {};
+    struct Session : list_hook<LruTag>, list_hook<TimerTag> {
+        int id;
+        int expires_at;
+        Session(int i, int t) : id(i), expires_at(t) {}
+    };
+
+    object_pool<Session> pool;
+    intrusive_list<Session, LruTag> lru;
+    intrusive_list<Session, TimerTag> timers;
+
+    std::vector<Session*> sessions;
+    for (int i = 0; i < 5; ++i) {
+        Session* s = pool.create(i, 10 + i * 5);
+        lru.push_front(*s);
+        timers.push_back(*s);  // Fixed TTL: insertion order is expiry order
+        sessions.push_back(s);
+    }
+
+    auto print = [](const char* label, const auto& list) {
+        std::cout << label;
+        for (const auto& s : list) std::cout << s.id << " ";
+        std::cout << "\n";
+    };
+    print("LRU (most recent first): ", lru);
+
+    lru.move_to_front(*sessions[1]);
+    lru.move_to_front(*sessions[3]);
+    print("After touching 1 and 3:  ", lru);
+
+    // Expire everything due by t=20: O(1) removal from both lists per session
+    int now = 20;
+    while (!timers.empty() && timers.front().expires_at <= now) {
+        Session& s = timers.front();
+        timers.pop_front();
+        lru.erase(s);
+        std::cout << std::format("Expired session {} (due {})\n", s.id, s.expires_at);
+        pool.destroy(&s);
+    }
+    print("LRU after expiry:        ", lru);
+    print("Timers after expiry:     ", timers);
+    std::cout << std::format("Pool: {} live, {} slots in {} block(s)\n",
+                             pool.size(), pool.capacity(), pool.block_count());
+
+    // splice and remove_if rewire links only
+    intrusive_list<Session, LruTag> other;
+    Session* extra = pool.create(42, 99);
+    other.push_back(*extra);
+    lru.splice(lru.begin(), other);
+    print("After splicing {42}:     ", lru);
+    lru.remove_if([](const Session& s) { return s.id % 2 == 0; });
+    print("After remove_if(even):   ", lru);
+    std::cout << std::format("Session 42 still linked in LRU? {}\n",
+                             static_cast<list_hook<LruTag>&>(*extra).is_linked());
+
+    lru.clear();
+    timers.clear();
+    for (Session* s : sessions)
+        if (s->id >= 3) pool.destroy(s);  // 0-2 were destroyed on expiry
+    pool.destroy(extra);
+
+    // Singly-linked FIFO of jobs
+    struct Job : slist_hook<> {
+        std::string name;
+        explicit Job(std::string n) : name(std::move(n)) {}
+    };
+    Job a("parse"), b("compile"), c("link");
+    intrusive_slist<Job> queue;
+    queue.push_back(a);
+    queue.push_back(b);
+    queue.push_front(c);
+    std::cout << "Job queue: ";
+    for (const auto& job : queue) std::cout << job.name << " ";
+    std::cout << std::format("(size {})\n", queue.size());
+}
+
+// ============================================================================
+// LRU BENCHMARK - std::list + iterator index vs intrusive list + object pool
+// Both caches splice on hit; only std::list allocates on miss and frees on
+// eviction.
+// ============================================================================
+void demonstrate_intrusive_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== LRU CACHE BENCHMARK ===\n";
+
+    const std::size_t capacity = 4096;
+    const std::size_t key_space = capacity * 4;
+    const std::size_t ops = scaled(1 << 20);
+
+    SplitMix64 rng;
+    std::vector<std::size_t> keys(ops);
+    for (auto& k : keys) {
+        // Skewed: half the traffic goes to an eighth of the keys
+        std::uint64_t r = rng.next();
+        k = (r & 1) ? (r >> 1) % (key_space / 8) : (r >> 1) % key_space;
+    }
+
+    struct Payload {
+        std::size_t key;
+        char data[48];
+    };
+
+    std::size_t std_hits = 0;
+    double std_ms = time_ms([&] {
+        std::list<Payload> lru;
+        std::vector<std::list<Payload>::iterator> index(key_space, lru.end());
+        for (std::size_t key : keys) {
+            if (index[key] != lru.end()) {
+                lru.splice(lru.begin(), lru, index[key]);
+                ++std_hits;
+                continue;
+            }
+            if (lru.size() == capacity) {
+                index[lru.back().key] = lru.end();
+                lru.pop_back();
+            }
+            lru.push_front(Payload{key, {}});
+            index[key] = lru.begin();
+        }
+    });
+
+    struct Entry : list_hook<> {
+        Payload payload;
+    };
+
+    std::size_t intrusive_hits = 0;
+    double intrusive_ms = time_ms([&] {
+        object_pool<Entry> pool;
+        pool.reserve(capacity);
+        intrusive_list<Entry> lru;
+        std::vector<Entry*> index(key_space, nullptr);
+        for (std::size_t key : keys) {
+            if (Entry* e = index[key]) {
+                lru.move_to_front(*e);
+                ++intrusive_hits;
+                continue;
+            }
+            if (lru.size() == capacity) {
+                Entry& victim = lru.back();
+                lru.pop_back();
+                index[victim.payload.key] = nullptr;
+                pool.destroy(&victim);
+            }
+            Entry* e = pool.create();
+            e->payload.key = key;
+            lru.push_front(*e);
+            index[key] = e;
+        }
+        lru.clear();
+        for (Entry* e : index)
+            if (e) pool.destroy(e);
+    });
+
+    std::cout << std::format("{} lookups, capacity {}, {} keys (hit rate {:.1f}%):\n",
+                             ops, capacity, key_space, 100.0 * std_hits / ops);
+    print_result("std::list + splice", std_ms, ops);
+    print_result("intrusive_list + object_pool", intrusive_ms, ops);
+    if (std_hits != intrusive_hits) std::cout << "  (hit counts differ!)\n";
+}
+
+void run_all_demos() {
+    demonstrate_intrusive_list();
+    demonstrate_intrusive_benchmark();
+}
+
+} // namespace cpp26_intrusive
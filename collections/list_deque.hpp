@@ -5,6 +5,7 @@
 #include <forward_list>
 #include <deque>
 #include <algorithm>
+#include <memory_resource>
 #include <format>
 
 namespace cpp26_list_deque {
@@ -353,6 +354,37 @@ void demonstrate_deque_algorithms() {
     }
 }
 
+// Demonstrates std::pmr::list / std::pmr::deque sharing a pool resource (C++17)
+void demonstrate_list_deque_pmr() {
+    std::cout << "\n=== PMR LIST & DEQUE (Pool Resource) ===\n";
+
+    // Size-class pools recycle freed list nodes instead of returning them to malloc
+    std::pmr::unsynchronized_pool_resource pool;
+
+    std::pmr::list<int> a({1, 2, 3}, &pool);
+    std::pmr::list<int> b({10, 20, 30}, &pool);
+
+    // splice() is O(1) only when both lists use equal allocators,
+    // which holds because they share the same resource
+    a.splice(std::next(a.begin()), b);
+    std::cout << "After splice: a=";
+    for (auto x : a) std::cout << x << " ";
+    std::cout << std::format(", b.size={}\n", b.size());
+
+    a.remove_if([](int x) { return x >= 20; });
+    a.push_back(4);  // Reuses a node freed by remove_if
+    std::cout << "After remove_if(x >= 20) + push_back(4): ";
+    for (auto x : a) std::cout << x << " ";
+    std::cout << "\n";
+
+    std::pmr::deque<int> dq(&pool);
+    for (int i = 0; i < 5; ++i) dq.push_front(i);
+    std::cout << "pmr::deque: ";
+    for (auto x : dq) std::cout << x << " ";
+    std::cout << std::format("\nSame resource: {}\n",
+                             a.get_allocator() == dq.get_allocator());
+}
+
 // Main runner for all list/deque demonstrations
 void run_all_demos() {
     // List demonstrations
@@ -370,6 +402,7 @@ void run_all_demos() {
     demonstrate_deque_modifiers();
     demonstrate_deque_capacity();
     demonstrate_deque_algorithms();
+    demonstrate_list_deque_pmr();
 }
 
 } // namespace cpp26_list_deque
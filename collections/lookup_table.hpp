@@ -0,0 +1,305 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <string_view>
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_lookup_table {
+
+// ============================================================================
+// MAKE_TABLE - Fill a std::array from a generator at compile time
+// The constexpr counterpart of Factorial<N>: instead of one value per
+// template instantiation, a consteval loop produces a whole table.
+// Reference: https://en.cppreference.com/w/cpp/language/consteval
+// ============================================================================
+template<typename T, std::size_t N, typename Generator>
+consteval std::array<T, N> make_table(Generator gen) {
+    std::array<T, N> table{};
+    for (std::size_t i = 0; i < N; ++i) table[i] = static_cast<T>(gen(i));
+    return table;
+}
+
+// ============================================================================
+// CONSTEXPR MATH - Series approximations usable during constant evaluation
+// <cmath> functions are not constexpr until C++26, so the tables are
+// generated from these and checked against std::sin/std::exp at runtime.
+// ============================================================================
+inline constexpr double pi = 3.14159265358979323846;
+
+constexpr double cx_sin(double x) {
+    while (x > pi) x -= 2 * pi;
+    while (x < -pi) x += 2 * pi;
+    double term = x, sum = x;
+    for (int n = 1; n < 12; ++n) {
+        term *= -x * x / ((2.0 * n) * (2.0 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cx_exp(double x) {
+    int halvings = 0;
+    while (x > 0.5 || x < -0.5) {
+        x /= 2;
+        ++halvings;
+    }
+    double term = 1, sum = 1;
+    for (int n = 1; n < 16; ++n) {
+        term *= x / n;
+        sum += term;
+    }
+    while (halvings-- > 0) sum *= sum;
+    return sum;
+}
+
+// ============================================================================
+// SAMPLED FUNCTION - f(x) tabulated on [lo, hi] with N intervals
+// N is the size/accuracy knob: linear interpolation error shrinks as 1/N^2,
+// nearest-sample error as 1/N, while the table grows by sizeof(T) per entry.
+// ============================================================================
+template<std::size_t N, typename T = float>
+class sampled_function {
+private:
+    T lo;
+    T scale;                      // N / (hi - lo)
+    std::array<T, N + 1> values;  // one guard sample so linear() can read i + 1
+
+public:
+    template<typename F>
+    constexpr sampled_function(double lo_, double hi_, F f)
+        : lo(static_cast<T>(lo_)), scale(static_cast<T>(N / (hi_ - lo_))), values{} {
+        for (std::size_t i = 0; i <= N; ++i)
+            values[i] = static_cast<T>(f(lo_ + (hi_ - lo_) * static_cast<double>(i) / N));
+    }
+
+    // Nearest sample; x is clamped to [lo, hi]
+    T nearest(T x) const {
+        T pos = std::clamp((x - lo) * scale, T{0}, static_cast<T>(N));
+        return values[static_cast<std::size_t>(pos + T{0.5})];
+    }
+
+    // Linear interpolation between the two surrounding samples
+    T linear(T x) const {
+        T pos = std::clamp((x - lo) * scale, T{0}, static_cast<T>(N));
+        std::size_t i = std::min(static_cast<std::size_t>(pos), N - 1);
+        T frac = pos - static_cast<T>(i);
+        return values[i] + frac * (values[i + 1] - values[i]);
+    }
+
+    static constexpr std::size_t intervals() { return N; }
+    static constexpr std::size_t bytes() { return sizeof(T) * (N + 1); }
+};
+
+// Tables are variable templates so each size is generated once, at compile time
+template<std::size_t N>
+inline constexpr sampled_function<N> sin_table(0.0, 2 * pi, cx_sin);
+
+template<std::size_t N>
+inline constexpr sampled_function<N> exp_table(-8.0, 8.0, cx_exp);
+
+// Periodic wrapper: reduces x into [0, 2*pi) before the lookup
+template<std::size_t N>
+float table_sin(float x) {
+    constexpr float two_pi = static_cast<float>(2 * pi);
+    float turns = x * static_cast<float>(1 / (2 * pi));
+    float whole = static_cast<float>(static_cast<std::int64_t>(turns)) - (turns < 0 ? 1.0f : 0.0f);
+    return sin_table<N>.linear((turns - whole) * two_pi);
+}
+
+// ============================================================================
+// CRC-32 - Table-driven (reflected 0xEDB88320) vs bit-at-a-time
+// ============================================================================
+inline constexpr auto crc32_table = make_table<std::uint32_t, 256>([](std::size_t i) {
+    auto crc = static_cast<std::uint32_t>(i);
+    for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+    return crc;
+});
+
+inline std::uint32_t crc32_bitwise(std::string_view data) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char c : data) {
+        crc ^= c;
+        for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+    }
+    return ~crc;
+}
+
+inline std::uint32_t crc32(std::string_view data) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char c : data) crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xFF];
+    return ~crc;
+}
+
+// ============================================================================
+// POPCOUNT - Per-byte table vs std::popcount (C++20)
+// ============================================================================
+inline constexpr auto popcount8_table = make_table<std::uint8_t, 256>([](std::size_t i) {
+    int bits = 0;
+    for (; i; i &= i - 1) ++bits;
+    return bits;
+});
+
+inline int popcount64_table(std::uint64_t x) {
+    int bits = 0;
+    for (int byte = 0; byte < 8; ++byte, x >>= 8) bits += popcount8_table[x & 0xFF];
+    return bits;
+}
+
+// ============================================================================
+// BYTE CLASSES - One table load replaces a chain of <cctype> calls in a lexer
+// ============================================================================
+enum ByteClass : std::uint8_t {
+    Digit = 1 << 0,
+    Alpha = 1 << 1,
+    Space = 1 << 2,
+    HexDigit = 1 << 3,
+    IdentStart = 1 << 4,
+    IdentChar = 1 << 5,
+    Operator = 1 << 6,
+};
+
+inline constexpr auto byte_class = make_table<std::uint8_t, 256>([](std::size_t i) {
+    char c = static_cast<char>(i);
+    bool digit = c >= '0' && c <= '9';
+    bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    bool hex = digit || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    bool space = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    bool op = std::string_view("+-*/%=<>!&|^~").find(c) != std::string_view::npos;
+    return (digit ? Digit : 0) | (alpha ? Alpha : 0) | (space ? Space : 0) | (hex ? HexDigit : 0) |
+           (alpha || c == '_' ? IdentStart : 0) | (alpha || digit || c == '_' ? IdentChar : 0) |
+           (op ? Operator : 0);
+});
+
+constexpr bool has_class(unsigned char c, std::uint8_t mask) {
+    return (byte_class[c] & mask) != 0;
+}
+
+void demonstrate_constexpr_tables() {
+    std::cout << "\n=== CONSTEXPR LOOKUP TABLES ===\n";
+
+    // Everything below is checked by the compiler
+    static_assert(crc32_table[1] == 0x77073096u);
+    static_assert(popcount8_table[0xFF] == 8 && popcount8_table[0x5A] == 4);
+    static_assert(has_class('_', IdentStart) && !has_class('7', IdentStart));
+    static_assert(has_class('F', HexDigit) && !has_class('g', HexDigit));
+
+    std::cout << std::format("crc32(\"123456789\") = {:08X} (table), {:08X} (bitwise)\n",
+                             crc32("123456789"), crc32_bitwise("123456789"));
+    std::cout << std::format("popcount64_table(0xF0F0) = {}, std::popcount = {}\n",
+                             popcount64_table(0xF0F0), std::popcount(0xF0F0u));
+
+    // A tiny lexer pass driven entirely by byte_class
+    std::string_view source = "let x1 = 0x2A + foo_bar * 7;";
+    std::cout << "Tokens in \"" << source << "\": ";
+    for (std::size_t i = 0; i < source.size();) {
+        auto c = static_cast<unsigned char>(source[i]);
+        std::size_t start = i;
+        if (has_class(c, Space)) { ++i; continue; }
+        if (has_class(c, IdentStart)) {
+            while (i < source.size() && has_class(source[i], IdentChar)) ++i;
+        } else if (has_class(c, Digit)) {
+            while (i < source.size() && has_class(source[i], HexDigit | Digit | Alpha)) ++i;
+        } else {
+            ++i;
+        }
+        std::cout << "[" << source.substr(start, i - start) << "] ";
+    }
+    std::cout << "\n";
+
+    // Size vs accuracy knob for the sine table
+    std::cout << "sin table size vs max error over [0, 2pi):\n";
+    auto report = [](const auto& table) {
+        double err_nearest = 0, err_linear = 0;
+        for (int k = 0; k < 100000; ++k) {
+            float x = static_cast<float>(2 * pi * k / 100000);
+            err_nearest = std::max(err_nearest, std::abs(table.nearest(x) - std::sin(static_cast<double>(x))));
+            err_linear = std::max(err_linear, std::abs(table.linear(x) - std::sin(static_cast<double>(x))));
+        }
+        std::cout << std::format("  N={:<6} {:>7} bytes  nearest {:.2e}  linear {:.2e}\n",
+                                 table.intervals(), table.bytes(), err_nearest, err_linear);
+    };
+    report(sin_table<64>);
+    report(sin_table<256>);
+    report(sin_table<1024>);
+    report(sin_table<4096>);
+
+    std::cout << std::format("exp table N=1024: exp(1.5) ~ {:.6f} (std::exp {:.6f})\n",
+                             exp_table<1024>.linear(1.5f), std::exp(1.5));
+}
+
+// ============================================================================
+// CROSSOVER BENCHMARK - When does a table beat the computation?
+// Small tables that stay in L1 win over transcendental calls; once a table
+// spills out of cache, or the computation is a single instruction
+// (popcnt with -march=native), the lookup loses.
+// ============================================================================
+void demonstrate_table_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== LOOKUP TABLE BENCHMARK ===\n";
+
+    const std::size_t n = scaled(1 << 20);
+    SplitMix64 rng;
+    std::vector<float> angles(n);
+    for (auto& a : angles) a = static_cast<float>(static_cast<double>(rng.next() % 1000000) * 1e-5 - 5.0);
+
+    std::cout << "sin over random angles:\n";
+    auto sum_over = [&](auto f) {
+        float sum = 0;
+        for (float a : angles) sum += f(a);
+        do_not_optimize(sum);
+    };
+    print_result("std::sin", best_of_ms(3, [&] { sum_over([](float a) { return std::sin(a); }); }), n);
+    print_result("table<256> linear", best_of_ms(3, [&] { sum_over(table_sin<256>); }), n);
+    print_result("table<4096> linear", best_of_ms(3, [&] { sum_over(table_sin<4096>); }), n);
+    print_result("table<16384> linear (64 KiB)", best_of_ms(3, [&] { sum_over(table_sin<16384>); }), n);
+
+    std::vector<std::uint64_t> words(n);
+    for (auto& w : words) w = rng.next();
+    std::cout << "popcount:\n";
+    print_result("std::popcount", best_of_ms(3, [&] {
+        std::size_t bits = 0;
+        for (auto w : words) bits += static_cast<std::size_t>(std::popcount(w));
+        do_not_optimize(bits);
+    }), n);
+    print_result("byte table", best_of_ms(3, [&] {
+        std::size_t bits = 0;
+        for (auto w : words) bits += static_cast<std::size_t>(popcount64_table(w));
+        do_not_optimize(bits);
+    }), n);
+
+    std::string text(n, ' ');
+    constexpr std::string_view alphabet = "abcXYZ_019 +=;\n";
+    for (auto& c : text) c = alphabet[rng.next() % alphabet.size()];
+    std::cout << "identifier chars in text:\n";
+    print_result("<cctype> isalnum || '_'", best_of_ms(3, [&] {
+        std::size_t count = 0;
+        for (unsigned char c : text) count += (std::isalnum(c) || c == '_');
+        do_not_optimize(count);
+    }), n);
+    print_result("byte_class table", best_of_ms(3, [&] {
+        std::size_t count = 0;
+        for (unsigned char c : text) count += has_class(c, IdentChar);
+        do_not_optimize(count);
+    }), n);
+
+    std::cout << "crc32 over text:\n";
+    print_result("bitwise", best_of_ms(3, [&] { do_not_optimize(crc32_bitwise(text)); }), n);
+    print_result("256-entry table", best_of_ms(3, [&] { do_not_optimize(crc32(text)); }), n);
+}
+
+void run_all_demos() {
+    demonstrate_constexpr_tables();
+    demonstrate_table_benchmark();
+}
+
+} // namespace cpp26_lookup_table
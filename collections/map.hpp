@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <memory_resource>
 #include <format>
 
 namespace cpp26_map {
@@ -273,6 +274,33 @@ void demonstrate_multimap() {
     }
 }
 
+// ============================================================================
+// PMR MAP - std::pmr::map with allocator propagation (C++17)
+// Reference: https://en.cppreference.com/w/cpp/memory/polymorphic_allocator
+// ============================================================================
+void demonstrate_map_pmr() {
+    std::cout << "\n=== PMR MAP (Allocator Propagation) ===\n";
+
+    std::pmr::monotonic_buffer_resource arena;
+
+    // polymorphic_allocator is uses-allocator aware: the map passes its
+    // resource down to every pmr::string key and value it constructs
+    std::pmr::map<std::pmr::string, std::pmr::string> config(&arena);
+    config.emplace("database.connection_string", "postgres://localhost:5432/showcase_database");
+    config.emplace("cache.eviction_policy", "least-recently-used with a 64 MiB budget");
+    config["log.level"] = "debug";
+
+    for (const auto& [key, value] : config) {
+        std::cout << std::format("  {} = {}\n", key, value);
+    }
+
+    const auto& [key, value] = *config.begin();
+    std::cout << std::format("Key uses map's resource: {}\n",
+                             key.get_allocator().resource() == &arena);
+    std::cout << std::format("Value uses map's resource: {}\n",
+                             value.get_allocator().resource() == &arena);
+}
+
 // Main runner for all map demonstrations
 void run_all_demos() {
     demonstrate_map_construction();
@@ -282,6 +310,7 @@ void run_all_demos() {
     demonstrate_map_lookup();
     demonstrate_map_custom_comparator();
     demonstrate_multimap();
+    demonstrate_map_pmr();
 }
 
 } // namespace cpp26_map
@@ -0,0 +1,592 @@
+#pragma once
+
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <functional>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_multiqueue {
+
+// ============================================================================
+// MULTIQUEUE - Relaxed concurrent priority queue from c*P sequential heaps
+// A std::priority_queue behind one mutex admits one thread at a time. A
+// MultiQueue spreads the elements over c*P heaps (P threads, c around 2),
+// each with its own try-lock and a cached copy of its top:
+//   - push locks a random heap; if it is busy, another random one
+//   - pop reads the cached tops of two random heaps and pops the better one
+// No operation waits for a particular lock: a busy heap is skipped for
+// another one, even by the sweep that pops from a nearly empty queue.
+// pop no longer returns the global minimum, but one close to it: the
+// expected rank error (elements smaller than the one returned) is O(c*P)
+// and independent of the queue size.
+// Handles add thread-local buffering: pushes are collected and inserted as a
+// batch under one lock, and pops take a batch from the chosen heap, trading
+// more rank error for fewer lock acquisitions.
+// Reference: Rihani, Sanders, Dementiev (2015), "MultiQueues: Simple Relaxed
+// Concurrent Priority Queues"; Williams, Sanders, Dementiev (2021),
+// "Engineering MultiQueues: Fast Relaxed Concurrent Priority Queues"
+// ============================================================================
+namespace detail {
+
+inline void cpu_relax(unsigned& spins) {
+    if (++spins < 64) {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+        _mm_pause();
+#endif
+    } else {
+        spins = 0;
+        std::this_thread::yield();
+    }
+}
+
+// Trivially copyable value kept in relaxed atomic words, so that a cached
+// top read without the lock is well defined (if possibly stale or torn;
+// it only steers the choice of heap)
+template<typename V>
+class atomic_cell {
+private:
+    static constexpr std::size_t words = (sizeof(V) + 7) / 8;
+    std::array<std::atomic<std::uint64_t>, words> data{};
+
+public:
+    V load() const {
+        std::uint64_t buffer[words];
+        for (std::size_t i = 0; i < words; ++i) buffer[i] = data[i].load(std::memory_order_relaxed);
+        V value;
+        std::memcpy(&value, buffer, sizeof(V));
+        return value;
+    }
+
+    void store(const V& value) {
+        std::uint64_t buffer[words] = {};
+        std::memcpy(buffer, &value, sizeof(V));
+        for (std::size_t i = 0; i < words; ++i) data[i].store(buffer[i], std::memory_order_relaxed);
+    }
+};
+
+inline std::uint64_t mul_high(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<__uint128_t>(a) * b) >> 64);
+#else
+    std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+    std::uint64_t mid = (la * lb >> 32) + static_cast<std::uint32_t>(ha * lb) + static_cast<std::uint32_t>(la * hb);
+    return ha * hb + (ha * lb >> 32) + (la * hb >> 32) + (mid >> 32);
+#endif
+}
+
+// xorshift64*; below(n) maps to [0, n) with a multiply instead of a modulo
+class fast_rng {
+private:
+    std::uint64_t state;
+
+public:
+    explicit fast_rng(std::uint64_t seed) : state(seed | 1) {}
+
+    std::uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    std::size_t below(std::size_t n) {
+        return static_cast<std::size_t>(mul_high(next(), n));
+    }
+};
+
+inline std::uint64_t thread_seed() {
+    return 0x9E3779B97F4A7C15ull ^ std::hash<std::thread::id>{}(std::this_thread::get_id());
+}
+
+} // namespace detail
+
+template<typename T, typename Compare = std::less<T>>
+class multiqueue {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "multiqueue: cached tops are read without locks, so T must be trivially copyable");
+
+private:
+    struct alignas(64) Queue {
+        std::atomic<bool> locked{false};
+        std::atomic<bool> has_top{false};
+        std::atomic<std::size_t> size{0};
+        detail::atomic_cell<T> top;
+        std::vector<T> heap;  // Guarded by locked
+    };
+
+    std::unique_ptr<Queue[]> queues;
+    std::size_t count;
+    [[no_unique_address]] Compare comp;
+
+    // std heap algorithms keep the largest on top; swapping the arguments keeps the smallest
+    auto heap_order() const {
+        return [this](const T& a, const T& b) { return comp(b, a); };
+    }
+
+    static bool try_lock(Queue& q) {
+        return !q.locked.load(std::memory_order_relaxed) && !q.locked.exchange(true, std::memory_order_acquire);
+    }
+
+    static void unlock(Queue& q) { q.locked.store(false, std::memory_order_release); }
+
+    static void publish(Queue& q) {
+        q.size.store(q.heap.size(), std::memory_order_relaxed);
+        if (!q.heap.empty()) q.top.store(q.heap.front());
+        q.has_top.store(!q.heap.empty(), std::memory_order_release);
+    }
+
+    // Publishes and unlocks a locked heap on scope exit, so a push_back
+    // that throws cannot leave it locked
+    struct held {
+        Queue& q;
+        ~held() {
+            publish(q);
+            unlock(q);
+        }
+    };
+
+    // Locks a random heap, skipping busy ones instead of waiting
+    Queue& lock_any(detail::fast_rng& rng) {
+        for (unsigned spins = 0;; detail::cpu_relax(spins)) {
+            Queue& q = queues[rng.below(count)];
+            if (try_lock(q)) return q;
+        }
+    }
+
+    template<typename It>
+    void push_batch(detail::fast_rng& rng, It first, It last) {
+        if (first == last) return;
+        Queue& q = lock_any(rng);
+        held guard{q};
+        for (; first != last; ++first) {
+            q.heap.push_back(*first);
+            std::push_heap(q.heap.begin(), q.heap.end(), heap_order());
+        }
+    }
+
+    // Moves up to k of q's smallest elements to out (smallest first), then
+    // unlocks q, which the caller has locked
+    std::size_t take(Queue& q, std::vector<T>& out, std::size_t k) {
+        held guard{q};
+        out.reserve(out.size() + std::min(k, q.heap.size()));  // The pops below cannot throw
+        std::size_t n = 0;
+        for (; n < k && !q.heap.empty(); ++n) {
+            std::pop_heap(q.heap.begin(), q.heap.end(), heap_order());
+            out.push_back(q.heap.back());
+            q.heap.pop_back();
+        }
+        return n;
+    }
+
+    // Two-choice pop of up to k elements; 0 only if every heap was seen empty
+    std::size_t pop_batch(detail::fast_rng& rng, std::vector<T>& out, std::size_t k) {
+        for (int attempt = 0; attempt < 16; ++attempt) {
+            Queue& a = queues[rng.below(count)];
+            Queue& b = queues[rng.below(count)];
+            bool has_a = a.has_top.load(std::memory_order_acquire);
+            bool has_b = b.has_top.load(std::memory_order_acquire);
+            if (!has_a && !has_b) continue;
+            Queue& q = !has_b ? a : !has_a ? b : comp(b.top.load(), a.top.load()) ? b : a;
+            if (!try_lock(q)) continue;
+            if (std::size_t n = take(q, out, k)) return n;
+        }
+        // Nearly empty: random pairs keep missing, so sweep every heap. Busy
+        // heaps are skipped too; sweep again only if one of them had elements.
+        for (unsigned spins = 0;; detail::cpu_relax(spins)) {
+            bool skipped = false;
+            std::size_t start = rng.below(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                Queue& q = queues[(start + i) % count];
+                if (!q.has_top.load(std::memory_order_acquire)) continue;
+                if (!try_lock(q)) {
+                    skipped = true;
+                    continue;
+                }
+                if (std::size_t n = take(q, out, k)) return n;
+            }
+            if (!skipped) return 0;
+        }
+    }
+
+    static detail::fast_rng& thread_rng() {
+        thread_local detail::fast_rng rng(detail::thread_seed());
+        return rng;
+    }
+
+public:
+    // Per-thread access point with optional buffering. buffer = 1 behaves
+    // like the unbuffered push/try_pop; larger buffers batch both directions.
+    // Buffered elements are invisible to other threads until flush() or
+    // the handle's destruction.
+    class handle {
+    private:
+        friend class multiqueue;
+        multiqueue* owner;
+        detail::fast_rng rng;
+        std::size_t buffer;
+        std::vector<T> pushes;  // Not yet in any heap; visible to this handle's pops
+        std::vector<T> pops;    // Taken from a heap, largest first so the best is at the back
+
+        handle(multiqueue& mq, std::size_t buffer_size, std::uint64_t seed)
+            : owner(&mq), rng(seed), buffer(std::max<std::size_t>(buffer_size, 1)) {}
+
+    public:
+        handle(handle&& other) noexcept
+            : owner(std::exchange(other.owner, nullptr)), rng(other.rng), buffer(other.buffer),
+              pushes(std::move(other.pushes)), pops(std::move(other.pops)) {}
+        handle& operator=(handle&&) = delete;
+        ~handle() {
+            if (owner) flush();
+        }
+
+        void push(const T& value) {
+            if (buffer == 1) {
+                owner->push_batch(rng, &value, &value + 1);
+                return;
+            }
+            pushes.push_back(value);
+            if (pushes.size() >= buffer) {
+                owner->push_batch(rng, pushes.begin(), pushes.end());
+                pushes.clear();
+            }
+        }
+
+        std::optional<T> try_pop() {
+            if (pops.empty() && owner->pop_batch(rng, pops, buffer)) std::reverse(pops.begin(), pops.end());
+            // The local push buffer competes with whatever came from the heaps
+            auto local = std::min_element(pushes.begin(), pushes.end(), owner->comp);
+            bool use_local = local != pushes.end() && (pops.empty() || owner->comp(*local, pops.back()));
+            if (use_local) {
+                T value = *local;
+                *local = pushes.back();
+                pushes.pop_back();
+                return value;
+            }
+            if (pops.empty()) return std::nullopt;
+            T value = pops.back();
+            pops.pop_back();
+            return value;
+        }
+
+        // Returns buffered elements to the heaps, e.g. before a thread goes idle
+        void flush() {
+            owner->push_batch(rng, pushes.begin(), pushes.end());
+            owner->push_batch(rng, pops.begin(), pops.end());
+            pushes.clear();
+            pops.clear();
+        }
+    };
+
+    // c heaps per thread; at least two so that pop has a choice
+    explicit multiqueue(std::size_t threads = std::max(1u, std::thread::hardware_concurrency()), std::size_t c = 2,
+                        const Compare& compare = Compare())
+        : queues(new Queue[std::max<std::size_t>(2, c * threads)]), count(std::max<std::size_t>(2, c * threads)),
+          comp(compare) {}
+
+    multiqueue(const multiqueue&) = delete;
+    multiqueue& operator=(const multiqueue&) = delete;
+
+    handle get_handle(std::size_t buffer = 1) { return handle(*this, buffer, thread_rng().next()); }
+
+    void push(const T& value) { push_batch(thread_rng(), &value, &value + 1); }
+
+    // A small element, not necessarily the smallest; nullopt only if every heap was empty when visited
+    std::optional<T> try_pop() {
+        std::vector<T> out;
+        out.reserve(1);
+        if (pop_batch(thread_rng(), out, 1) == 0) return std::nullopt;
+        return out.front();
+    }
+
+    // Elements in the heaps, excluding handle buffers; approximate while threads are active
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) total += queues[i].size.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    bool empty() const { return size() == 0; }
+    std::size_t queue_count() const { return count; }
+};
+
+// ============================================================================
+// QUALITY - Rank error of pops, replayed on one thread
+// P handles take turns at random on one thread, so each pop sees a definite
+// queue content and its rank (how many smaller elements were in the queue,
+// including other handles' buffers) is exact. A Fenwick tree over the key
+// range counts the smaller keys.
+// ============================================================================
+struct rank_error {
+    double mean = 0;
+    std::size_t p99 = 0;
+    std::size_t max = 0;
+};
+
+inline rank_error measure_rank_error(std::size_t handles, std::size_t c, std::size_t buffer, std::size_t prefill,
+                                     std::size_t ops) {
+    constexpr std::uint32_t key_bits = 20;
+    constexpr std::size_t key_range = std::size_t{1} << key_bits;
+    std::vector<std::uint32_t> tree(key_range + 1);
+    auto add = [&](std::uint32_t key, std::int32_t delta) {
+        for (std::size_t i = key + 1; i <= key_range; i += i & -i) tree[i] += static_cast<std::uint32_t>(delta);
+    };
+    auto smaller = [&](std::uint32_t key) {
+        std::size_t n = 0;
+        for (std::size_t i = key; i > 0; i -= i & -i) n += tree[i];
+        return n;
+    };
+
+    multiqueue<std::uint32_t> mq(handles, c);
+    std::vector<multiqueue<std::uint32_t>::handle> hs;
+    for (std::size_t i = 0; i < handles; ++i) hs.push_back(mq.get_handle(buffer));
+
+    cpp26_benchmark::SplitMix64 rng(handles * 131 + c * 7 + buffer);
+    auto push = [&](auto& h) {
+        auto key = static_cast<std::uint32_t>(rng.next() >> (64 - key_bits));
+        add(key, 1);
+        h.push(key);
+    };
+    for (std::size_t i = 0; i < prefill; ++i) push(hs[i % handles]);
+
+    std::vector<std::size_t> ranks;
+    ranks.reserve(ops);
+    for (std::size_t i = 0; i < ops; ++i) {
+        auto& h = hs[rng.next() % handles];
+        if (rng.next() & 1) {
+            push(h);
+        } else if (auto key = h.try_pop()) {
+            ranks.push_back(smaller(*key));
+            add(*key, -1);
+        }
+    }
+
+    rank_error result;
+    if (ranks.empty()) return result;
+    double sum = 0;
+    for (auto r : ranks) sum += static_cast<double>(r);
+    result.mean = sum / static_cast<double>(ranks.size());
+    std::sort(ranks.begin(), ranks.end());
+    result.p99 = ranks[ranks.size() * 99 / 100];
+    result.max = ranks.back();
+    return result;
+}
+
+// ============================================================================
+// EXAMPLE - Parallel single-source shortest paths (label correcting)
+// Relaxed pops may process a vertex before its final distance is known; it
+// is then simply relaxed again later. Distances are atomic minimums, and a
+// counter of unfinished work items tells the threads when to stop.
+// ============================================================================
+using cpp26_benchmark::graph;
+using cpp26_benchmark::unreachable;
+
+struct work_item {
+    std::uint64_t dist;
+    std::uint32_t vertex;
+
+    bool operator<(const work_item& other) const { return dist < other.dist; }
+};
+
+struct sssp_stats {
+    std::size_t pops = 0;
+    std::size_t stale = 0;  // Pops whose distance was already improved
+};
+
+inline std::vector<std::uint64_t> parallel_sssp(const graph& g, std::uint32_t source, int threads, std::size_t buffer,
+                                                sssp_stats& stats) {
+    std::vector<std::atomic<std::uint64_t>> dist(g.vertices());
+    for (auto& d : dist) d.store(unreachable, std::memory_order_relaxed);
+    multiqueue<work_item> mq(static_cast<std::size_t>(threads));
+    std::atomic<std::int64_t> pending{1};
+    std::atomic<std::size_t> pops{0}, stale{0};
+
+    dist[source].store(0);
+    mq.push({0, source});
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            auto h = mq.get_handle(buffer);
+            std::size_t my_pops = 0, my_stale = 0;
+            unsigned spins = 0;
+            while (pending.load(std::memory_order_acquire) > 0) {
+                auto item = h.try_pop();
+                if (!item) {
+                    detail::cpu_relax(spins);
+                    continue;
+                }
+                ++my_pops;
+                if (item->dist > dist[item->vertex].load(std::memory_order_relaxed)) {
+                    ++my_stale;
+                } else {
+                    for (std::uint32_t e = g.offsets[item->vertex]; e < g.offsets[item->vertex + 1]; ++e) {
+                        std::uint64_t nd = item->dist + g.weights[e];
+                        auto& target = dist[g.targets[e]];
+                        std::uint64_t current = target.load(std::memory_order_relaxed);
+                        while (nd < current && !target.compare_exchange_weak(current, nd, std::memory_order_relaxed)) {}
+                        if (nd < current) {
+                            pending.fetch_add(1, std::memory_order_relaxed);
+                            h.push({nd, g.targets[e]});
+                        }
+                    }
+                }
+                pending.fetch_sub(1, std::memory_order_release);
+            }
+            pops += my_pops;
+            stale += my_stale;
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    stats = {pops.load(), stale.load()};
+    std::vector<std::uint64_t> result(g.vertices());
+    for (std::size_t v = 0; v < result.size(); ++v) result[v] = dist[v].load();
+    return result;
+}
+
+void demonstrate_multiqueue() {
+    std::cout << "\n=== MULTIQUEUE (Relaxed Concurrent Priority Queue) ===\n";
+
+    multiqueue<int> mq(4);
+    std::cout << std::format("4 threads, c = 2: {} heaps\n", mq.queue_count());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&mq, t] {
+            for (int i = 0; i < 1000; ++i) mq.push(i * 4 + t);
+        });
+    }
+    for (auto& th : threads) th.join();
+    std::cout << std::format("After 4 x 1000 concurrent pushes: size={}\n", mq.size());
+
+    std::cout << "First pops (exact would be 0 1 2 3 ...):";
+    for (int i = 0; i < 12; ++i) std::cout << ' ' << *mq.try_pop();
+    std::cout << "\n";
+
+    std::size_t left = 0;
+    while (mq.try_pop()) ++left;
+    std::cout << std::format("Drained the other {}; try_pop on empty: {}\n", left, mq.try_pop().has_value());
+
+    const graph g = cpp26_benchmark::random_graph(cpp26_benchmark::scaled(50'000), 8, 42);
+    const auto expected = cpp26_benchmark::dijkstra(g, 0);
+    for (std::size_t buffer : {1, 16}) {
+        sssp_stats stats;
+        auto dist = parallel_sssp(g, 0, 4, buffer, stats);
+        std::cout << std::format("Parallel SSSP, 4 threads, buffer {:>2}: matches Dijkstra: {}, {} pops ({} stale)\n",
+                                 buffer, dist == expected, stats.pops, stats.stale);
+    }
+}
+
+// ============================================================================
+// BENCHMARK - Throughput vs std::priority_queue + mutex, and pop quality
+// ============================================================================
+void demonstrate_multiqueue_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== MULTIQUEUE BENCHMARK ===\n";
+
+    const std::size_t prefill = scaled(100'000);
+    const std::size_t total_ops = scaled(1'000'000);
+
+    struct locked_queue {
+        std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>> pq;
+        std::mutex mutex;
+
+        void push(std::uint64_t v) {
+            std::lock_guard lock(mutex);
+            pq.push(v);
+        }
+        std::optional<std::uint64_t> try_pop() {
+            std::lock_guard lock(mutex);
+            if (pq.empty()) return std::nullopt;
+            auto v = pq.top();
+            pq.pop();
+            return v;
+        }
+    };
+
+    // Each thread: 50% push, 50% pop, on a queue prefilled with `prefill` keys
+    auto run = [&](int threads, auto make_access) {
+        const std::size_t ops_per_thread = total_ops / static_cast<std::size_t>(threads);
+        return time_ms([&] {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    auto access = make_access();
+                    SplitMix64 rng(static_cast<std::uint64_t>(t) + 1);
+                    std::uint64_t sum = 0;
+                    for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                        std::uint64_t r = rng.next();
+                        if (r & 1) access.push(r >> 1);
+                        else if (auto v = access.try_pop()) sum += *v;
+                    }
+                    do_not_optimize(sum);
+                });
+            }
+            for (auto& w : workers) w.join();
+        });
+    };
+
+    std::cout << std::format("hardware threads: {}, {} ops per run, 50% push / 50% pop:\n",
+                             std::thread::hardware_concurrency(), total_ops);
+    SplitMix64 fill(99);
+    std::vector<std::uint64_t> initial(prefill);
+    for (auto& v : initial) v = fill.next() >> 1;
+
+    for (int threads : {1, 2, 4, 8, 16}) {
+        locked_queue locked;
+        for (auto v : initial) locked.pq.push(v);
+        struct locked_access {
+            locked_queue* q;
+            void push(std::uint64_t v) { q->push(v); }
+            std::optional<std::uint64_t> try_pop() { return q->try_pop(); }
+        };
+        print_result(std::format("priority_queue + mutex, {} thr", threads),
+                     run(threads, [&] { return locked_access{&locked}; }), total_ops);
+
+        for (std::size_t buffer : {1, 16}) {
+            multiqueue<std::uint64_t> mq(static_cast<std::size_t>(threads));
+            for (auto v : initial) mq.push(v);
+            print_result(std::format("multiqueue c=2, buffer {}, {} thr", buffer, threads),
+                         run(threads, [&] { return mq.get_handle(buffer); }), total_ops);
+        }
+    }
+
+    // A priority_queue behind a lock has rank error 0 by construction
+    std::cout << "Rank error (smaller elements present at each pop), single-thread replay:\n";
+    std::cout << std::format("  {:<8} {:>4} {:>7} {:>10} {:>8} {:>8}\n", "handles", "c", "buffer", "mean", "p99", "max");
+    const std::size_t quality_ops = scaled(200'000);
+    const std::pair<std::size_t, std::size_t> configs[] = {{2, 1}, {4, 1}, {2, 16}};  // {c, buffer}
+    for (std::size_t handles : {4, 16, 64}) {
+        for (auto [c, buffer] : configs) {
+            rank_error err = measure_rank_error(handles, c, buffer, prefill, quality_ops);
+            std::cout << std::format("  {:<8} {:>4} {:>7} {:>10.1f} {:>8} {:>8}\n", handles, c, buffer, err.mean,
+                                     err.p99, err.max);
+        }
+    }
+}
+
+void run_all_demos() {
+    demonstrate_multiqueue();
+    demonstrate_multiqueue_benchmark();
+}
+
+} // namespace cpp26_multiqueue
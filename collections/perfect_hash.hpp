@@ -0,0 +1,312 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+#include "hashing.hpp"
+
+namespace cpp26_perfect_hash {
+
+// ============================================================================
+// PERFECT HASHING - Collision-free tables for key sets known at compile time
+// A consteval builder (the same machinery as consteval_square in
+// templates.hpp, scaled up to a search) assigns every key its own slot
+// using hash-and-displace (as in CHD/PTHash):
+//   1. hash each key once and split the keys into ~N/2 small buckets
+//   2. place the largest buckets first: for each bucket, try pilot values
+//      0, 1, 2, ... until slot(hash, pilot) is free for all of its keys
+// A lookup reads the bucket's pilot, computes one slot, and compares the
+// one key stored there: no probing and no chains. Duplicate keys, or a
+// search that cannot finish, are compile errors.
+// Reference: https://arxiv.org/abs/2104.10402 (PTHash)
+// ============================================================================
+namespace detail {
+
+using cpp26_hash::mix_murmur3;  // constexpr, so it also runs in the builder
+
+// Little-endian load of `bytes` characters; a fixed count compiles to one load
+constexpr std::uint64_t read_le(std::string_view s, std::size_t pos, std::size_t bytes) {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < bytes; ++i) v |= std::uint64_t{static_cast<unsigned char>(s[pos + i])} << (8 * i);
+    return v;
+}
+
+// Word-at-a-time string hash in the style of wyhash's short-input path:
+// two overlapping reads cover keys up to 16 bytes; longer keys fold the
+// leading 8-byte chunks first. constexpr, so the builder and lookups agree.
+constexpr std::uint64_t hash_key(std::string_view s) {
+    const std::size_t n = s.size();
+    std::uint64_t a = 0, b = 0;
+    if (n >= 8) {
+        for (std::size_t i = 0; i + 8 < n; i += 8) a = mix_murmur3(a ^ read_le(s, i, 8));
+        b = read_le(s, n - 8, 8);
+    } else if (n >= 4) {
+        a = read_le(s, 0, 4);
+        b = read_le(s, n - 4, 4);
+    } else if (n > 0) {
+        a = read_le(s, 0, 1) | read_le(s, n / 2, 1) << 8 | read_le(s, n - 1, 1) << 16;
+    }
+    return mix_murmur3((a * 0x9E3779B97F4A7C15ull) ^ b ^ (n * 0xC2B2AE3D27D4EB4Full));
+}
+
+template<typename T>
+    requires std::is_integral_v<T> || std::is_enum_v<T>
+constexpr std::uint64_t hash_key(T value) {
+    return mix_murmur3(static_cast<std::uint64_t>(value));
+}
+
+} // namespace detail
+
+template<typename Key, typename Value, std::size_t N>
+class perfect_map {
+public:
+    static_assert(N > 0 && N < 65535, "perfect_map: 1..65534 keys");
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using index_type = std::conditional_t<(N < 255), std::uint8_t, std::uint16_t>;
+
+    static constexpr std::size_t table_size = std::bit_ceil(N + N / 4 + 1);  // Load <= 0.8
+    static constexpr std::size_t bucket_count = N / 2 + 1;
+
+private:
+    static constexpr index_type empty = std::numeric_limits<index_type>::max();
+    static constexpr std::uint32_t max_pilot = 1u << 20;
+
+    std::array<value_type, N> entries{};
+    std::array<std::uint32_t, bucket_count> pilots{};
+    std::array<index_type, table_size> slots{};
+
+    static constexpr std::size_t bucket_of(std::uint64_t h) {
+        return static_cast<std::size_t>(((h >> 32) * bucket_count) >> 32);
+    }
+
+    static constexpr std::size_t slot_of(std::uint64_t h, std::uint32_t pilot) {
+        return static_cast<std::size_t>(detail::mix_murmur3(h ^ (pilot * 0x9E3779B97F4A7C15ull)) & (table_size - 1));
+    }
+
+public:
+    // Throwing inside constant evaluation turns a bad key set into a compile error
+    constexpr explicit perfect_map(const value_type (&list)[N]) {
+        std::array<std::uint64_t, N> hashes{};
+        std::array<std::size_t, bucket_count> sizes{};
+        for (std::size_t i = 0; i < N; ++i) {
+            entries[i] = list[i];
+            hashes[i] = detail::hash_key(list[i].first);
+            ++sizes[bucket_of(hashes[i])];
+            for (std::size_t j = 0; j < i; ++j) {
+                if (list[j].first == list[i].first) throw std::invalid_argument("perfect_map: duplicate key");
+                if (hashes[j] == hashes[i]) throw std::invalid_argument("perfect_map: 64-bit hash collision");
+            }
+        }
+
+        std::array<std::size_t, bucket_count> order{};
+        for (std::size_t b = 0; b < bucket_count; ++b) order[b] = b;
+        std::ranges::sort(order, [&](std::size_t a, std::size_t b) { return sizes[a] != sizes[b] ? sizes[a] > sizes[b] : a < b; });
+        slots.fill(empty);
+
+        std::array<std::size_t, N> members{};
+        std::array<std::size_t, N> taken{};
+        for (std::size_t b : order) {
+            if (sizes[b] == 0) break;
+            std::size_t m = 0;
+            for (std::size_t i = 0; i < N; ++i)
+                if (bucket_of(hashes[i]) == b) members[m++] = i;
+
+            std::uint32_t pilot = 0;
+            for (;; ++pilot) {
+                if (pilot == max_pilot) throw std::runtime_error("perfect_map: no pilot found");
+                bool fits = true;
+                for (std::size_t k = 0; k < m && fits; ++k) {
+                    taken[k] = slot_of(hashes[members[k]], pilot);
+                    fits = slots[taken[k]] == empty;
+                    for (std::size_t j = 0; j < k && fits; ++j) fits = taken[j] != taken[k];
+                }
+                if (fits) break;
+            }
+            pilots[b] = pilot;
+            for (std::size_t k = 0; k < m; ++k) slots[taken[k]] = static_cast<index_type>(members[k]);
+        }
+    }
+
+    // Entry index of key in the original list, or N
+    constexpr std::size_t index_of(const Key& key) const {
+        std::uint64_t h = detail::hash_key(key);
+        index_type i = slots[slot_of(h, pilots[bucket_of(h)])];
+        return i != empty && entries[i].first == key ? i : N;
+    }
+
+    constexpr const Value* find(const Key& key) const {
+        std::size_t i = index_of(key);
+        return i < N ? &entries[i].second : nullptr;
+    }
+
+    constexpr bool contains(const Key& key) const { return index_of(key) < N; }
+
+    constexpr const Value& at(const Key& key) const {
+        if (const Value* v = find(key)) return *v;
+        throw std::out_of_range("perfect_map::at: unknown key");
+    }
+
+    constexpr auto begin() const { return entries.begin(); }
+    constexpr auto end() const { return entries.end(); }
+    static constexpr std::size_t size() { return N; }
+    static constexpr std::size_t memory_bytes() { return sizeof(perfect_map); }
+};
+
+// Deduces N from a braced list: make_perfect_map<std::string_view, int>({{"a", 1}, {"b", 2}})
+template<typename Key, typename Value, std::size_t N>
+consteval perfect_map<Key, Value, N> make_perfect_map(const std::pair<Key, Value> (&entries)[N]) {
+    return perfect_map<Key, Value, N>(entries);
+}
+
+// Maps each key to its position in the list: keyword -> enumerator
+template<typename Key, std::size_t N>
+consteval perfect_map<Key, std::size_t, N> make_perfect_index(const Key (&keys)[N]) {
+    std::pair<Key, std::size_t> entries[N];
+    for (std::size_t i = 0; i < N; ++i) entries[i] = {keys[i], i};
+    return perfect_map<Key, std::size_t, N>(entries);
+}
+
+// ============================================================================
+// EXAMPLE - A command table as a key-value store would parse it
+// ============================================================================
+enum class command : std::uint8_t {
+    get, set, del, exists, incr, decr, append, expire,
+    ttl, keys, scan, ping, echo, quit, select, flushdb,
+    unknown
+};
+
+inline constexpr auto command_table = make_perfect_map<std::string_view, command>({
+    {"get", command::get},       {"set", command::set},       {"del", command::del},
+    {"exists", command::exists}, {"incr", command::incr},     {"decr", command::decr},
+    {"append", command::append}, {"expire", command::expire}, {"ttl", command::ttl},
+    {"keys", command::keys},     {"scan", command::scan},     {"ping", command::ping},
+    {"echo", command::echo},     {"quit", command::quit},     {"select", command::select},
+    {"flushdb", command::flushdb},
+});
+
+// HTTP status codes: sparse integers, same machinery
+inline constexpr auto status_text = make_perfect_map<int, std::string_view>({
+    {200, "OK"},           {201, "Created"},   {204, "No Content"},          {301, "Moved Permanently"},
+    {304, "Not Modified"}, {400, "Bad Request"}, {401, "Unauthorized"},      {403, "Forbidden"},
+    {404, "Not Found"},    {409, "Conflict"},  {500, "Internal Server Error"}, {503, "Service Unavailable"},
+});
+
+inline command parse_command(std::string_view name) {
+    const command* c = command_table.find(name);
+    return c ? *c : command::unknown;
+}
+
+// Hand-written baseline: switch on the first character, then compare
+inline command parse_command_switch(std::string_view name) {
+    if (name.empty()) return command::unknown;
+    switch (name[0]) {
+    case 'a': if (name == "append") return command::append; break;
+    case 'd':
+        if (name == "del") return command::del;
+        if (name == "decr") return command::decr;
+        break;
+    case 'e':
+        if (name == "exists") return command::exists;
+        if (name == "expire") return command::expire;
+        if (name == "echo") return command::echo;
+        break;
+    case 'f': if (name == "flushdb") return command::flushdb; break;
+    case 'g': if (name == "get") return command::get; break;
+    case 'i': if (name == "incr") return command::incr; break;
+    case 'k': if (name == "keys") return command::keys; break;
+    case 'p': if (name == "ping") return command::ping; break;
+    case 'q': if (name == "quit") return command::quit; break;
+    case 's':
+        if (name == "set") return command::set;
+        if (name == "scan") return command::scan;
+        if (name == "select") return command::select;
+        break;
+    case 't': if (name == "ttl") return command::ttl; break;
+    }
+    return command::unknown;
+}
+
+void demonstrate_perfect_hash() {
+    std::cout << "\n=== COMPILE-TIME PERFECT HASHING ===\n";
+
+    // Built and queried entirely by the compiler
+    static_assert(command_table.at("expire") == command::expire);
+    static_assert(!command_table.contains("sett"));
+    static_assert(status_text.at(404) == "Not Found");
+    static_assert(make_perfect_index<std::string_view>({"red", "green", "blue"}).index_of("blue") == 2);
+
+    std::cout << std::format("command_table: {} keys, {} slots, {} buckets, {} bytes\n",
+                             command_table.size(), command_table.table_size, command_table.bucket_count,
+                             command_table.memory_bytes());
+    for (std::string_view name : {"get", "flushdb", "ttl", "gett", "Get"}) {
+        std::cout << std::format("  parse_command(\"{}\") = {}\n", name, static_cast<int>(parse_command(name)));
+    }
+    for (int code : {200, 404, 418}) {
+        const std::string_view* text = status_text.find(code);
+        std::cout << std::format("  status {} -> {}\n", code, text ? *text : "(unknown)");
+    }
+}
+
+// ============================================================================
+// BENCHMARK - Command lookup: perfect_map vs std::unordered_map vs switch
+// ============================================================================
+void demonstrate_perfect_hash_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== PERFECT HASH BENCHMARK ===\n";
+
+    std::vector<std::string> vocabulary;
+    for (const auto& [name, cmd] : command_table) vocabulary.emplace_back(name);
+    for (const char* miss : {"gett", "SET", "delete", "incrby", "pong", "x", "flush", "selects"}) vocabulary.emplace_back(miss);
+
+    const std::size_t n = scaled(1'000'000);
+    SplitMix64 rng(3);
+    std::vector<std::string_view> input(n);
+    for (auto& word : input) word = vocabulary[rng.next() % vocabulary.size()];
+
+    std::unordered_map<std::string_view, command> umap;
+    for (const auto& [name, cmd] : command_table) umap.emplace(name, cmd);
+
+    auto run = [&](const char* label, auto parse) {
+        std::size_t sum = 0;
+        double ms = best_of_ms(3, [&] {
+            for (auto word : input) sum += static_cast<std::size_t>(parse(word));
+        });
+        do_not_optimize(sum);
+        print_result(label, ms, n);
+        return sum;
+    };
+
+    std::cout << std::format("{} lookups over {} commands + {} misses:\n", n, command_table.size(),
+                             vocabulary.size() - command_table.size());
+    auto a = run("std::unordered_map<string_view>", [&](std::string_view w) {
+        auto it = umap.find(w);
+        return it != umap.end() ? it->second : command::unknown;
+    });
+    auto b = run("switch on first char", parse_command_switch);
+    auto c = run("perfect_map", parse_command);
+    std::cout << std::format("results agree: {}\n", a == b && b == c);
+}
+
+void run_all_demos() {
+    demonstrate_perfect_hash();
+    demonstrate_perfect_hash_benchmark();
+}
+
+} // namespace cpp26_perfect_hash
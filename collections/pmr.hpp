@@ -0,0 +1,320 @@
+#pragma once
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_pmr {
+
+// ============================================================================
+// BUMP ARENA - Monotonic bump-pointer memory_resource with release-all
+// Allocation is a pointer increment, deallocation is a no-op, and the whole
+// arena is dropped in one go. Unlike std::pmr::monotonic_buffer_resource,
+// reset() keeps the largest block so a reused arena stops calling upstream.
+// Reference: https://en.cppreference.com/w/cpp/memory/memory_resource
+// ============================================================================
+class BumpArena : public std::pmr::memory_resource {
+private:
+    // Header stored at the start of every block obtained from upstream
+    struct Block {
+        Block* next;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* upstream;
+    Block* head = nullptr;          // Most recent (and largest) block
+    std::uintptr_t cursor = 0;      // Next free byte in head
+    std::uintptr_t limit = 0;       // One past the end of head
+    std::size_t next_block_size;
+    std::size_t used = 0;           // Bytes handed out since the last reset
+    std::size_t blocks = 0;
+
+    static std::uintptr_t align_up(std::uintptr_t value, std::size_t alignment) {
+        return (value + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    }
+
+    void add_block(std::size_t bytes, std::size_t alignment) {
+        std::size_t size = std::max(next_block_size, sizeof(Block) + bytes + alignment);
+        void* memory = upstream->allocate(size, alignof(std::max_align_t));
+        head = ::new (memory) Block{head, size};
+        cursor = reinterpret_cast<std::uintptr_t>(head + 1);
+        limit = reinterpret_cast<std::uintptr_t>(memory) + size;
+        next_block_size = size * 2;  // Geometric growth keeps the block count logarithmic
+        ++blocks;
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        std::uintptr_t p = align_up(cursor, alignment);
+        if (head == nullptr || p + bytes > limit) [[unlikely]] {
+            add_block(bytes, alignment);
+            p = align_up(cursor, alignment);
+        }
+        cursor = p + bytes;
+        used += bytes;
+        return reinterpret_cast<void*>(p);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {
+        // Individual frees are ignored; memory comes back on reset()/release()
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit BumpArena(std::size_t initial_block_size = 4096,
+                       std::pmr::memory_resource* upstream_resource = std::pmr::get_default_resource())
+        : upstream(upstream_resource), next_block_size(initial_block_size) {}
+
+    BumpArena(const BumpArena&) = delete;
+    BumpArena& operator=(const BumpArena&) = delete;
+
+    ~BumpArena() override { release(); }
+
+    // Returns every block to upstream
+    void release() {
+        while (head != nullptr) {
+            Block* next = head->next;
+            upstream->deallocate(head, head->size, alignof(std::max_align_t));
+            head = next;
+        }
+        cursor = limit = 0;
+        used = 0;
+        blocks = 0;
+    }
+
+    // Drops all allocations but keeps the largest block for the next round
+    void reset() {
+        if (head == nullptr) return;
+        Block* keep = head;
+        head = head->next;
+        release();
+        head = keep;
+        head->next = nullptr;
+        cursor = reinterpret_cast<std::uintptr_t>(head + 1);
+        limit = reinterpret_cast<std::uintptr_t>(head) + head->size;
+        blocks = 1;
+    }
+
+    std::size_t bytes_used() const { return used; }
+    std::size_t block_count() const { return blocks; }
+    std::size_t capacity() const { return head ? head->size : 0; }
+};
+
+// ============================================================================
+// REQUEST SCOPE - Per-request arena lifecycle
+// Containers declared after the scope are destroyed before it, after which
+// the arena is reset in O(1) and its memory reused by the next request.
+// ============================================================================
+class RequestScope {
+private:
+    BumpArena& arena;
+
+public:
+    explicit RequestScope(BumpArena& a) : arena(a) {}
+    ~RequestScope() { arena.reset(); }
+
+    RequestScope(const RequestScope&) = delete;
+    RequestScope& operator=(const RequestScope&) = delete;
+
+    std::pmr::memory_resource* resource() const { return &arena; }
+};
+
+// Runs handler with a fresh per-request resource; the result must not
+// reference arena memory because the arena is reset on return
+template<typename Handler>
+auto with_request_arena(BumpArena& arena, Handler&& handler) {
+    RequestScope scope(arena);
+    return handler(scope.resource());
+}
+
+// ============================================================================
+// COUNTING RESOURCE - Wraps another resource and counts upstream traffic
+// ============================================================================
+class CountingResource : public std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* upstream;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        bytes_allocated += bytes;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    std::size_t allocations = 0;
+    std::size_t bytes_allocated = 0;
+
+    explicit CountingResource(std::pmr::memory_resource* upstream_resource = std::pmr::get_default_resource())
+        : upstream(upstream_resource) {}
+};
+
+void demonstrate_bump_arena() {
+    std::cout << "\n=== BUMP ARENA ===\n";
+
+    BumpArena arena(1024);
+
+    {
+        std::pmr::vector<int> vec(&arena);
+        for (int i = 0; i < 100; ++i) vec.push_back(i);
+
+        std::pmr::map<int, std::pmr::string> names(&arena);
+        names.emplace(1, "one");
+        names.emplace(2, "a string long enough to skip the small string buffer");
+
+        std::cout << std::format("vector size={}, map size={}\n", vec.size(), names.size());
+        std::cout << std::format("bytes_used={}, blocks={}, largest block={} bytes\n",
+                                 arena.bytes_used(), arena.block_count(), arena.capacity());
+
+        // The map's pmr::string values were allocated from the same arena
+        std::cout << std::format("value uses arena: {}\n",
+                                 names[2].get_allocator().resource() == &arena);
+    }
+
+    arena.release();
+    std::cout << std::format("After release(): bytes_used={}, blocks={}\n",
+                             arena.bytes_used(), arena.block_count());
+}
+
+void demonstrate_request_arena() {
+    std::cout << "\n=== PER-REQUEST ARENA LIFECYCLE ===\n";
+
+    CountingResource upstream;
+    BumpArena arena(256, &upstream);
+
+    const std::vector<std::string> requests = {
+        "get user alice", "get user bob", "put item 42 widget", "get item 42", "delete user bob"
+    };
+
+    for (const auto& request : requests) {
+        std::size_t before = upstream.allocations;
+
+        auto word_count = with_request_arena(arena, [&](std::pmr::memory_resource* resource) {
+            std::pmr::vector<std::pmr::string> words(resource);
+            std::pmr::unordered_map<std::pmr::string, int> freq(resource);
+            std::size_t start = 0;
+            while (start < request.size()) {
+                std::size_t end = request.find(' ', start);
+                if (end == std::string::npos) end = request.size();
+                words.emplace_back(std::string_view(request).substr(start, end - start));
+                ++freq[words.back()];
+                start = end + 1;
+            }
+            return words.size();
+        });
+
+        std::cout << std::format("  '{}': {} words, upstream allocations this request={}\n",
+                                 request, word_count, upstream.allocations - before);
+    }
+
+    std::cout << std::format("Arena blocks retained between requests: {}\n", arena.block_count());
+}
+
+// ============================================================================
+// ALLOCATOR BENCHMARK - Same workload under three memory strategies
+// ============================================================================
+template<typename StdContainer, typename PmrContainer, typename Workload>
+void compare_allocators(const std::string& name, const std::vector<int>& keys, Workload workload) {
+    using namespace cpp26_benchmark;
+
+    std::cout << std::format("{} ({} keys):\n", name, keys.size());
+
+    double t_default = best_of_ms(3, [&] {
+        StdContainer c;
+        do_not_optimize(workload(c, keys));
+    });
+
+    double t_pool = best_of_ms(3, [&] {
+        std::pmr::unsynchronized_pool_resource pool;
+        PmrContainer c(&pool);
+        do_not_optimize(workload(c, keys));
+    });
+
+    BumpArena arena;
+    double t_arena = best_of_ms(3, [&] {
+        RequestScope scope(arena);
+        PmrContainer c(scope.resource());
+        do_not_optimize(workload(c, keys));
+    });
+
+    print_result("std::allocator", t_default, keys.size());
+    print_result("pmr::unsynchronized_pool_resource", t_pool, keys.size());
+    print_result("BumpArena (reused per request)", t_arena, keys.size());
+}
+
+void demonstrate_allocator_benchmark() {
+    std::cout << "\n=== ALLOCATOR BENCHMARK (insert / lookup / erase) ===\n";
+
+    const std::size_t n = cpp26_benchmark::scaled(100'000);
+    cpp26_benchmark::SplitMix64 rng;
+    std::vector<int> keys(n);
+    for (auto& k : keys) k = static_cast<int>(rng.next() % (n * 4));
+
+    auto sequence_workload = [](auto& c, const std::vector<int>& keys) {
+        for (int k : keys) c.push_back(k);
+        std::size_t checksum = 0;
+        for (int x : c) checksum += static_cast<std::size_t>(x);
+        return checksum + c.size();
+    };
+
+    auto list_workload = [](auto& c, const std::vector<int>& keys) {
+        for (int k : keys) c.push_back(k);
+        c.remove_if([](int x) { return x % 2 == 0; });
+        for (int k : keys) c.push_front(k);
+        return c.size();
+    };
+
+    auto map_workload = [](auto& c, const std::vector<int>& keys) {
+        for (int k : keys) c.emplace(k, k);
+        std::size_t hits = 0;
+        for (int k : keys) hits += c.count(k + 1);
+        for (std::size_t i = 0; i < keys.size(); i += 2) c.erase(keys[i]);
+        return hits + c.size();
+    };
+
+    auto set_workload = [](auto& c, const std::vector<int>& keys) {
+        for (int k : keys) c.insert(k);
+        std::size_t hits = 0;
+        for (int k : keys) hits += c.count(k + 1);
+        for (std::size_t i = 0; i < keys.size(); i += 2) c.erase(keys[i]);
+        return hits + c.size();
+    };
+
+    compare_allocators<std::vector<int>, std::pmr::vector<int>>("vector push_back", keys, sequence_workload);
+    compare_allocators<std::list<int>, std::pmr::list<int>>("list push/remove_if", keys, list_workload);
+    compare_allocators<std::map<int, int>, std::pmr::map<int, int>>("map", keys, map_workload);
+    compare_allocators<std::set<int>, std::pmr::set<int>>("set", keys, set_workload);
+    compare_allocators<std::unordered_map<int, int>, std::pmr::unordered_map<int, int>>(
+        "unordered_map", keys, map_workload);
+}
+
+void run_all_demos() {
+    demonstrate_bump_arena();
+    demonstrate_request_arena();
+    demonstrate_allocator_benchmark();
+}
+
+} // namespace cpp26_pmr
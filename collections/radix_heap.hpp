@@ -0,0 +1,400 @@
+#pragma once
+
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <array>
+#include <string>
+#include <concepts>
+#include <functional>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_radix_heap {
+
+// ============================================================================
+// RADIX HEAP - Monotone priority queue for integer keys
+// Valid when keys never go below the last key taken out (timer deadlines,
+// Dijkstra with non-negative integer weights). Elements live in B+1 buckets
+// by the highest bit in which their key differs from `last`, the most
+// recently extracted minimum: bucket 0 holds keys equal to last, bucket i
+// keys that first differ at bit i-1. When bucket 0 runs dry, the first
+// non-empty bucket supplies the new last (its minimum) and its elements are
+// redistributed; each one lands in a strictly lower bucket. An element can
+// therefore move at most B times: amortized O(log C) per operation for keys
+// spanning C, with a scan and no comparisons between elements.
+// Reference: Ahuja, Mehlhorn, Orlin, Tarjan (1990), "Faster algorithms for
+// the shortest path problem"
+// ============================================================================
+template<std::integral Key, typename Value = void>
+class radix_heap {
+private:
+    using ukey = std::make_unsigned_t<Key>;
+    using element = std::conditional_t<std::is_void_v<Value>, ukey, std::pair<ukey, Value>>;
+    static constexpr std::size_t bits = std::numeric_limits<ukey>::digits;
+
+    std::array<std::vector<element>, bits + 1> buckets;
+    std::uint64_t occupied = 0;  // Bit i-1 set when bucket i (1..bits) is non-empty
+    ukey last = 0;               // Encoded; every stored key is >= last
+    std::size_t count = 0;
+
+    // Signed keys keep their order as unsigned once the sign bit is flipped
+    static constexpr ukey encode(Key key) {
+        if constexpr (std::is_signed_v<Key>) return static_cast<ukey>(key) ^ (ukey{1} << (bits - 1));
+        else return key;
+    }
+    static constexpr Key decode(ukey key) {
+        if constexpr (std::is_signed_v<Key>) return static_cast<Key>(key ^ (ukey{1} << (bits - 1)));
+        else return key;
+    }
+
+    static ukey key_of(const element& e) {
+        if constexpr (std::is_void_v<Value>) return e;
+        else return e.first;
+    }
+
+    void put(element&& e) {
+        auto b = static_cast<std::size_t>(std::bit_width(static_cast<ukey>(key_of(e) ^ last)));
+        buckets[b].push_back(std::move(e));
+        if (b) occupied |= std::uint64_t{1} << (b - 1);
+    }
+
+    void check(Key key) const {
+        if (encode(key) < last) throw std::invalid_argument("radix_heap::push: key below the last extracted key");
+    }
+
+    // Makes bucket 0 non-empty; the heap must not be empty
+    void refill() {
+        if (!buckets[0].empty()) return;
+        std::size_t b = static_cast<std::size_t>(std::countr_zero(occupied)) + 1;
+        auto& from = buckets[b];
+        occupied &= ~(std::uint64_t{1} << (b - 1));
+        last = key_of(*std::min_element(from.begin(), from.end(),
+                                        [](const element& x, const element& y) { return key_of(x) < key_of(y); }));
+        for (auto& e : from) put(std::move(e));
+        from.clear();
+    }
+
+public:
+    radix_heap() = default;
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // Lower bound for future keys: the last key returned by top()
+    Key last_key() const { return decode(last); }
+
+    void push(Key key) requires std::is_void_v<Value> {
+        check(key);
+        put(encode(key));
+        ++count;
+    }
+
+    template<typename V> requires(!std::is_void_v<Value>)
+    void push(Key key, V&& value) {
+        check(key);
+        put({encode(key), std::forward<V>(value)});
+        ++count;
+    }
+
+    // Smallest key; after this call no key below it may be pushed
+    Key top() {
+        refill();
+        return decode(key_of(buckets[0].back()));
+    }
+
+    template<typename V = Value> requires(!std::is_void_v<V>)
+    V& top_value() {
+        refill();
+        return buckets[0].back().second;
+    }
+
+    void pop() {
+        refill();
+        buckets[0].pop_back();
+        --count;
+    }
+
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        occupied = 0;
+        last = 0;
+        count = 0;
+    }
+};
+
+// ============================================================================
+// BUCKET QUEUE - One bucket per key for keys within a small window (Dial)
+// If every stored key lies within span of the last extracted key (Dijkstra
+// with weights <= span, timers at most span ticks ahead), a ring of span+1
+// buckets indexed by key holds each distinct key in its own bucket. A
+// bitmap of non-empty buckets lets top() skip empty runs 64 at a time.
+// push and pop are O(1); finding the next key costs O(span / 64) at worst.
+// Key-only queues keep a count per bucket instead of a vector.
+// Reference: Dial (1969), "Algorithm 360: Shortest-path forest with
+// topological ordering"
+// ============================================================================
+template<std::unsigned_integral Key, typename Value = void>
+class bucket_queue {
+private:
+    using bucket = std::conditional_t<std::is_void_v<Value>, std::size_t, std::vector<Value>>;
+
+    std::vector<bucket> buckets;  // Key k lives in buckets[k & mask]
+    std::vector<std::uint64_t> occupied;
+    std::size_t mask;
+    Key span;
+    Key cursor = 0;  // The last extracted key; no stored key is below it
+    std::size_t count = 0;
+
+    static bool is_empty(const bucket& b) {
+        if constexpr (std::is_void_v<Value>) return b == 0;
+        else return b.empty();
+    }
+
+    std::size_t next_occupied(std::size_t from) const {
+        std::size_t w = from / 64;
+        std::uint64_t word = occupied[w] & (~std::uint64_t{0} << (from % 64));
+        while (word == 0) {
+            w = (w + 1) % occupied.size();
+            word = occupied[w];
+        }
+        return w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+    }
+
+    std::size_t index_for(Key key) const {
+        if (key < cursor || key - cursor > span)
+            throw std::invalid_argument("bucket_queue::push: key outside [last extracted, last extracted + span]");
+        return key & mask;
+    }
+
+    void mark(std::size_t b) {
+        occupied[b / 64] |= std::uint64_t{1} << (b % 64);
+        ++count;
+    }
+
+    // Moves the cursor to the smallest stored key; the queue must not be empty
+    void advance() {
+        std::size_t here = cursor & mask;
+        if (!is_empty(buckets[here])) return;
+        std::size_t next = next_occupied(here);
+        cursor += static_cast<Key>(next >= here ? next - here : next + buckets.size() - here);
+    }
+
+public:
+    explicit bucket_queue(Key max_span)
+        : buckets(std::max<std::size_t>(64, std::bit_ceil(static_cast<std::size_t>(max_span) + 1))),
+          occupied(buckets.size() / 64), mask(buckets.size() - 1), span(max_span) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // Keys may be pushed in [last_key(), last_key() + span]
+    Key last_key() const { return cursor; }
+
+    void push(Key key) requires std::is_void_v<Value> {
+        std::size_t b = index_for(key);
+        ++buckets[b];
+        mark(b);
+    }
+
+    template<typename V> requires(!std::is_void_v<Value>)
+    void push(Key key, V&& value) {
+        std::size_t b = index_for(key);
+        buckets[b].push_back(std::forward<V>(value));
+        mark(b);
+    }
+
+    Key top() {
+        advance();
+        return cursor;
+    }
+
+    template<typename V = Value> requires(!std::is_void_v<V>)
+    V& top_value() {
+        advance();
+        return buckets[cursor & mask].back();
+    }
+
+    void pop() {
+        advance();
+        std::size_t b = cursor & mask;
+        if constexpr (std::is_void_v<Value>) --buckets[b];
+        else buckets[b].pop_back();
+        if (is_empty(buckets[b])) occupied[b / 64] &= ~(std::uint64_t{1} << (b % 64));
+        --count;
+    }
+};
+
+void demonstrate_radix_heap() {
+    std::cout << "\n=== RADIX HEAP / BUCKET QUEUE ===\n";
+
+    // Timer deadlines: always scheduled in the future of the current time
+    radix_heap<std::uint32_t, std::string> timers;
+    timers.push(500, "heartbeat");
+    timers.push(120, "flush log");
+    timers.push(120, "ack batch");
+    timers.push(9000, "rotate keys");
+
+    std::cout << "Fire:";
+    for (int i = 0; i < 2; ++i) {
+        std::cout << std::format(" {}@{}", timers.top_value(), timers.top());
+        timers.pop();
+    }
+    std::cout << std::format("\nNow t={}; schedule \"retry\" at t={}\n", timers.last_key(), timers.last_key() + 50);
+    timers.push(timers.last_key() + 50, "retry");
+    try {
+        timers.push(100, "too late");
+    } catch (const std::invalid_argument& e) {
+        std::cout << std::format("push(100): {}\n", e.what());
+    }
+    std::cout << "Fire:";
+    while (!timers.empty()) {
+        std::cout << std::format(" {}@{}", timers.top_value(), timers.top());
+        timers.pop();
+    }
+    std::cout << "\n";
+
+    // Signed keys work as long as they are monotone
+    radix_heap<int> temperatures;
+    for (int t : {-40, 12, -3, 0, 7}) temperatures.push(t);
+    std::cout << "radix_heap<int> pops:";
+    while (!temperatures.empty()) {
+        std::cout << ' ' << temperatures.top();
+        temperatures.pop();
+    }
+    std::cout << "\n";
+
+    // Keys within 100 of the last extracted one: a 128-bucket ring
+    bucket_queue<std::uint32_t> ring(100);
+    for (std::uint32_t k : {30u, 10u, 95u, 10u, 55u}) ring.push(k);
+    std::cout << "bucket_queue(span 100) pops:";
+    while (!ring.empty()) {
+        std::uint32_t k = ring.top();
+        ring.pop();
+        std::cout << ' ' << k;
+        if (k == 30) ring.push(125);  // Within 100 of 30
+    }
+    std::cout << "\n";
+}
+
+// ============================================================================
+// BENCHMARK - Monotone workloads vs std::priority_queue<int, vector, greater>
+// Hold model: a queue of n keys where every step pops the minimum and
+// pushes it back delayed by a random amount in [1, span], like a timer
+// queue or discrete-event simulation.
+// ============================================================================
+template<typename Queue>
+double hold_model(Queue queue, std::size_t n, std::size_t steps, int span) {
+    using namespace cpp26_benchmark;
+    SplitMix64 rng(n);
+    for (std::size_t i = 0; i < n; ++i) queue.push(static_cast<int>(rng.next() % static_cast<std::uint64_t>(span)));
+    std::vector<int> delays(4096);
+    for (auto& d : delays) d = 1 + static_cast<int>(rng.next() % static_cast<std::uint64_t>(span));
+
+    std::uint64_t sum = 0;
+    double ms = time_ms([&] {
+        for (std::size_t i = 0; i < steps; ++i) {
+            int key = static_cast<int>(queue.top());
+            queue.pop();
+            sum += static_cast<std::uint64_t>(key);
+            queue.push(key + delays[i % delays.size()]);
+        }
+    });
+    do_not_optimize(sum);
+    return ms;
+}
+
+using cpp26_benchmark::graph;
+
+// Dijkstra with lazy deletion over any queue with push(key, vertex),
+// top() -> key and top_value() -> vertex
+template<typename Queue>
+std::vector<std::uint32_t> dijkstra(const graph& g, std::uint32_t source, Queue& queue) {
+    constexpr auto unreachable = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> dist(g.vertices(), unreachable);
+    dist[source] = 0;
+    queue.push(0u, source);
+    while (!queue.empty()) {
+        std::uint32_t d = queue.top();
+        std::uint32_t v = queue.top_value();
+        queue.pop();
+        if (d != dist[v]) continue;
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint32_t nd = d + g.weights[e];
+            if (nd < dist[g.targets[e]]) {
+                dist[g.targets[e]] = nd;
+                queue.push(nd, g.targets[e]);
+            }
+        }
+    }
+    return dist;
+}
+
+// std::priority_queue in the same shape
+struct binary_heap_queue {
+    using item = std::pair<std::uint32_t, std::uint32_t>;
+    std::priority_queue<item, std::vector<item>, std::greater<item>> pq;
+
+    bool empty() const { return pq.empty(); }
+    void push(std::uint32_t key, std::uint32_t v) { pq.push({key, v}); }
+    std::uint32_t top() const { return pq.top().first; }
+    std::uint32_t top_value() const { return pq.top().second; }
+    void pop() { pq.pop(); }
+};
+
+void demonstrate_radix_heap_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== RADIX HEAP BENCHMARK ===\n";
+
+    const std::size_t steps = scaled(2'000'000);
+    const int span = 1000;
+    std::cout << std::format("Hold model, {} pop+push steps, delays in [1, {}]:\n", steps, span);
+    for (std::size_t base : {1'000, 100'000, 1'000'000}) {
+        const std::size_t n = scaled(base);
+        std::cout << std::format("  queue size {}:\n", n);
+        print_result("    std::priority_queue<int, greater>",
+                     hold_model(std::priority_queue<int, std::vector<int>, std::greater<int>>(), n, steps, span),
+                     steps);
+        print_result("    radix_heap<int>", hold_model(radix_heap<int>(), n, steps, span), steps);
+        print_result("    bucket_queue<uint32_t>(span)", hold_model(bucket_queue<std::uint32_t>(span), n, steps, span),
+                     steps);
+    }
+
+    const std::size_t vertices = scaled(200'000);
+    const std::uint32_t max_weight = 1000;
+    graph g = random_graph(vertices, 8, 2024, max_weight);
+    std::cout << std::format("Dijkstra, {} vertices, {} edges, weights 1..{}:\n", vertices, vertices * 8, max_weight);
+
+    std::vector<std::uint32_t> expected;
+    print_result("  std::priority_queue (lazy deletion)", best_of_ms(3, [&] {
+        binary_heap_queue q;
+        expected = dijkstra(g, 0, q);
+    }), g.targets.size());
+
+    bool radix_ok = true, bucket_ok = true;
+    print_result("  radix_heap<uint32_t, uint32_t>", best_of_ms(3, [&] {
+        radix_heap<std::uint32_t, std::uint32_t> q;
+        radix_ok = dijkstra(g, 0, q) == expected;
+    }), g.targets.size());
+    print_result("  bucket_queue (Dial)", best_of_ms(3, [&] {
+        bucket_queue<std::uint32_t, std::uint32_t> q(max_weight);
+        bucket_ok = dijkstra(g, 0, q) == expected;
+    }), g.targets.size());
+    std::cout << std::format("  distances match: radix_heap {}, bucket_queue {}\n", radix_ok, bucket_ok);
+}
+
+void run_all_demos() {
+    demonstrate_radix_heap();
+    demonstrate_radix_heap_benchmark();
+}
+
+} // namespace cpp26_radix_heap
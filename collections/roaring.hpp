@@ -0,0 +1,858 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <unordered_set>
+#include <span>
+#include <bit>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_roaring {
+
+// ============================================================================
+// ROARING BITMAP - Compressed set of 32-bit integers (Chambi, Lemire et al.)
+// The high 16 bits of a value select a chunk; each non-empty chunk holds its
+// low 16 bits in whichever container is smallest:
+//   array  - sorted uint16 values, up to 4096 of them (2 bytes per value)
+//   bitmap - 65536 bits in 1024 words, for denser chunks (8 KiB flat)
+//   run    - (start, length - 1) pairs for long consecutive ranges
+// Set operations walk the two sorted key lists and combine container pairs
+// with merge, galloping, bit-test or word-wise (AVX2) kernels. serialize()
+// writes the portable Roaring format shared by the C, Java and Go libraries.
+// Reference: https://github.com/RoaringBitmap/RoaringFormatSpec
+// ============================================================================
+class roaring_bitmap {
+private:
+    static constexpr std::uint32_t array_max = 4096;
+    static constexpr std::size_t bitmap_words = 1024;
+
+    enum class kind : std::uint8_t { array, bitmap, run };
+
+    struct container {
+        kind type = kind::array;
+        std::uint32_t card = 0;
+        std::vector<std::uint16_t> values;  // array: sorted values; run: (start, length - 1) pairs
+        std::vector<std::uint64_t> words;   // bitmap: bitmap_words words
+
+        bool contains(std::uint16_t v) const {
+            switch (type) {
+            case kind::array:
+                return std::binary_search(values.begin(), values.end(), v);
+            case kind::bitmap:
+                return words[v >> 6] >> (v & 63) & 1;
+            default: {
+                // Last run starting at or before v
+                std::size_t lo = 0, hi = values.size() / 2;
+                while (lo < hi) {
+                    std::size_t mid = (lo + hi) / 2;
+                    if (values[2 * mid] <= v) lo = mid + 1;
+                    else hi = mid;
+                }
+                return lo > 0 && v - values[2 * (lo - 1)] <= values[2 * (lo - 1) + 1];
+            }
+            }
+        }
+
+        template<typename F>
+        void for_each(std::uint32_t high, F&& f) const {
+            switch (type) {
+            case kind::array:
+                for (auto v : values) f(high | v);
+                return;
+            case kind::bitmap:
+                for (std::size_t w = 0; w < bitmap_words; ++w)
+                    for (std::uint64_t bits = words[w]; bits; bits &= bits - 1)
+                        f(high | static_cast<std::uint32_t>(w * 64 + std::countr_zero(bits)));
+                return;
+            default:
+                for (std::size_t i = 0; i < values.size(); i += 2)
+                    for (std::uint32_t v = values[i]; v <= std::uint32_t{values[i]} + values[i + 1]; ++v) f(high | v);
+                return;
+            }
+        }
+
+        std::size_t bytes() const {
+            return sizeof(container) + values.capacity() * sizeof(std::uint16_t) +
+                   words.capacity() * sizeof(std::uint64_t);
+        }
+    };
+
+    std::vector<std::uint16_t> keys;  // Sorted high halves, parallel to containers
+    std::vector<container> containers;
+
+    // ---- container construction and conversion -------------------------------
+
+    static container make_array(std::vector<std::uint16_t> values) {
+        container c;
+        c.card = static_cast<std::uint32_t>(values.size());
+        c.values = std::move(values);
+        return c;
+    }
+
+    static std::uint32_t count_words(const std::uint64_t* w) {
+        std::uint32_t card = 0;
+        for (std::size_t i = 0; i < bitmap_words; ++i) card += static_cast<std::uint32_t>(std::popcount(w[i]));
+        return card;
+    }
+
+    static container make_bitmap(std::vector<std::uint64_t> words, std::uint32_t card) {
+        container c;
+        c.type = kind::bitmap;
+        c.card = card;
+        c.words = std::move(words);
+        return c;
+    }
+
+    static std::vector<std::uint64_t> bitmap_from_array(const std::vector<std::uint16_t>& values) {
+        std::vector<std::uint64_t> words(bitmap_words);
+        for (auto v : values) words[v >> 6] |= std::uint64_t{1} << (v & 63);
+        return words;
+    }
+
+    static std::vector<std::uint16_t> array_from_bitmap(const std::vector<std::uint64_t>& words, std::uint32_t card) {
+        std::vector<std::uint16_t> values;
+        values.reserve(card);
+        for (std::size_t w = 0; w < bitmap_words; ++w)
+            for (std::uint64_t bits = words[w]; bits; bits &= bits - 1)
+                values.push_back(static_cast<std::uint16_t>(w * 64 + std::countr_zero(bits)));
+        return values;
+    }
+
+    // Array for up to array_max values, bitmap beyond
+    static void normalize(container& c) {
+        if (c.type == kind::array && c.card > array_max) {
+            c = make_bitmap(bitmap_from_array(c.values), c.card);
+        } else if (c.type == kind::bitmap && c.card <= array_max) {
+            c = make_array(array_from_bitmap(c.words, c.card));
+        } else if (c.type == kind::array) {
+            c.values.shrink_to_fit();
+        }
+    }
+
+    static container expand_runs(const container& c) {
+        if (c.card > array_max) {
+            std::vector<std::uint64_t> words(bitmap_words);
+            for (std::size_t i = 0; i < c.values.size(); i += 2) {
+                std::uint32_t start = c.values[i], end = start + c.values[i + 1];
+                for (std::uint32_t v = start; v <= end; ++v) words[v >> 6] |= std::uint64_t{1} << (v & 63);
+            }
+            return make_bitmap(std::move(words), c.card);
+        }
+        std::vector<std::uint16_t> values;
+        values.reserve(c.card);
+        c.for_each(0, [&](std::uint32_t v) { values.push_back(static_cast<std::uint16_t>(v)); });
+        return make_array(std::move(values));
+    }
+
+    // Runs are expanded before being combined; results are re-normalized
+    static const container& plain(const container& c, container& scratch) {
+        if (c.type != kind::run) return c;
+        scratch = expand_runs(c);
+        return scratch;
+    }
+
+    static std::size_t count_runs(const container& c) {
+        if (c.type == kind::run) return c.values.size() / 2;
+        if (c.type == kind::array) {
+            std::size_t runs = c.values.empty() ? 0 : 1;
+            for (std::size_t i = 1; i < c.values.size(); ++i) runs += c.values[i] != c.values[i - 1] + 1;
+            return runs;
+        }
+        // A run starts at every set bit whose lower neighbour is clear
+        std::size_t runs = 0;
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < bitmap_words; ++i) {
+            std::uint64_t w = c.words[i];
+            runs += static_cast<std::size_t>(std::popcount(w & ~((w << 1) | carry)));
+            carry = w >> 63;
+        }
+        return runs;
+    }
+
+    static container to_runs(const container& c) {
+        container out;
+        out.type = kind::run;
+        out.card = c.card;
+        std::uint32_t start = 0, prev = 0;
+        bool open = false;
+        c.for_each(0, [&](std::uint32_t v) {
+            if (open && v == prev + 1) {
+                prev = v;
+                return;
+            }
+            if (open) {
+                out.values.push_back(static_cast<std::uint16_t>(start));
+                out.values.push_back(static_cast<std::uint16_t>(prev - start));
+            }
+            start = prev = v;
+            open = true;
+        });
+        if (open) {
+            out.values.push_back(static_cast<std::uint16_t>(start));
+            out.values.push_back(static_cast<std::uint16_t>(prev - start));
+        }
+        return out;
+    }
+
+    // ---- container kernels ------------------------------------------------------
+
+    enum class word_op { bit_or, bit_and, bit_andnot, bit_xor };
+
+    template<word_op Op>
+    static std::uint64_t apply(std::uint64_t a, std::uint64_t b) {
+        if constexpr (Op == word_op::bit_or) return a | b;
+        else if constexpr (Op == word_op::bit_and) return a & b;
+        else if constexpr (Op == word_op::bit_andnot) return a & ~b;
+        else return a ^ b;
+    }
+
+#if defined(__AVX2__)
+    template<word_op Op>
+    static __m256i apply(__m256i a, __m256i b) {
+        if constexpr (Op == word_op::bit_or) return _mm256_or_si256(a, b);
+        else if constexpr (Op == word_op::bit_and) return _mm256_and_si256(a, b);
+        else if constexpr (Op == word_op::bit_andnot) return _mm256_andnot_si256(b, a);
+        else return _mm256_xor_si256(a, b);
+    }
+#endif
+
+    // Word-wise combine of two bitmaps, 256 bits per step with AVX2
+    template<word_op Op>
+    static container combine_bitmaps(const container& a, const container& b) {
+        std::vector<std::uint64_t> out(bitmap_words);
+        const std::uint64_t* x = a.words.data();
+        const std::uint64_t* y = b.words.data();
+#if defined(__AVX2__)
+        for (std::size_t i = 0; i < bitmap_words; i += 4) {
+            __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), apply<Op>(vx, vy));
+        }
+#else
+        for (std::size_t i = 0; i < bitmap_words; ++i) out[i] = apply<Op>(x[i], y[i]);
+#endif
+        container c = make_bitmap(std::move(out), 0);
+        c.card = count_words(c.words.data());
+        normalize(c);
+        return c;
+    }
+
+    // Bits of an array applied to a copy of a bitmap (or, andnot, xor)
+    template<word_op Op>
+    static container apply_array_to_bitmap(const container& bitmap, const container& array) {
+        container c = bitmap;
+        for (auto v : array.values) {
+            std::uint64_t& w = c.words[v >> 6];
+            std::uint64_t before = w;
+            w = apply<Op>(w, std::uint64_t{1} << (v & 63));
+            if (w > before) ++c.card;
+            else if (w < before) --c.card;
+        }
+        normalize(c);
+        return c;
+    }
+
+    // Array values kept (or dropped) according to membership in a bitmap
+    static container filter_array(const container& array, const container& bitmap, bool keep_members) {
+        std::vector<std::uint16_t> values;
+        values.reserve(array.card);
+        for (auto v : array.values)
+            if (static_cast<bool>(bitmap.words[v >> 6] >> (v & 63) & 1) == keep_members) values.push_back(v);
+        return make_array(std::move(values));
+    }
+
+    // Galloping pays off when one side is much smaller than the other
+    static std::vector<std::uint16_t> intersect_arrays(const std::vector<std::uint16_t>& a,
+                                                       const std::vector<std::uint16_t>& b) {
+        const auto& small = a.size() <= b.size() ? a : b;
+        const auto& large = a.size() <= b.size() ? b : a;
+        std::vector<std::uint16_t> out;
+        out.reserve(small.size());
+        if (small.size() * 32 < large.size()) {
+            auto it = large.begin();
+            for (auto v : small) {
+                std::size_t step = 1;
+                auto probe = it;
+                while (probe != large.end() && *probe < v) {
+                    it = probe;
+                    probe = static_cast<std::size_t>(large.end() - probe) > step ? probe + static_cast<std::ptrdiff_t>(step) : large.end();
+                    step *= 2;
+                }
+                it = std::lower_bound(it, probe, v);
+                if (it == large.end()) break;
+                if (*it == v) out.push_back(v);
+            }
+        } else {
+            std::size_t i = 0, j = 0;
+            while (i < small.size() && j < large.size()) {
+                std::uint16_t x = small[i], y = large[j];
+                if (x == y) out.push_back(x);
+                i += x <= y;
+                j += y <= x;
+            }
+        }
+        return out;
+    }
+
+    static container container_or(const container& a0, const container& b0) {
+        container sa, sb;
+        const container& a = plain(a0, sa);
+        const container& b = plain(b0, sb);
+        if (a.type == kind::bitmap && b.type == kind::bitmap) return combine_bitmaps<word_op::bit_or>(a, b);
+        if (a.type == kind::bitmap) return apply_array_to_bitmap<word_op::bit_or>(a, b);
+        if (b.type == kind::bitmap) return apply_array_to_bitmap<word_op::bit_or>(b, a);
+        std::vector<std::uint16_t> values;
+        values.reserve(a.card + b.card);
+        std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(values));
+        container c = make_array(std::move(values));
+        normalize(c);
+        return c;
+    }
+
+    static container container_and(const container& a0, const container& b0) {
+        container sa, sb;
+        const container& a = plain(a0, sa);
+        const container& b = plain(b0, sb);
+        if (a.type == kind::bitmap && b.type == kind::bitmap) return combine_bitmaps<word_op::bit_and>(a, b);
+        if (a.type == kind::bitmap) return filter_array(b, a, true);
+        if (b.type == kind::bitmap) return filter_array(a, b, true);
+        return make_array(intersect_arrays(a.values, b.values));
+    }
+
+    static container container_andnot(const container& a0, const container& b0) {
+        container sa, sb;
+        const container& a = plain(a0, sa);
+        const container& b = plain(b0, sb);
+        if (a.type == kind::bitmap && b.type == kind::bitmap) return combine_bitmaps<word_op::bit_andnot>(a, b);
+        if (a.type == kind::bitmap) return apply_array_to_bitmap<word_op::bit_andnot>(a, b);
+        if (b.type == kind::bitmap) return filter_array(a, b, false);
+        std::vector<std::uint16_t> values;
+        values.reserve(a.card);
+        std::set_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(values));
+        return make_array(std::move(values));
+    }
+
+    static container container_xor(const container& a0, const container& b0) {
+        container sa, sb;
+        const container& a = plain(a0, sa);
+        const container& b = plain(b0, sb);
+        if (a.type == kind::bitmap && b.type == kind::bitmap) return combine_bitmaps<word_op::bit_xor>(a, b);
+        if (a.type == kind::bitmap) return apply_array_to_bitmap<word_op::bit_xor>(a, b);
+        if (b.type == kind::bitmap) return apply_array_to_bitmap<word_op::bit_xor>(b, a);
+        std::vector<std::uint16_t> values;
+        values.reserve(a.card + b.card);
+        std::set_symmetric_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                                      std::back_inserter(values));
+        container c = make_array(std::move(values));
+        normalize(c);
+        return c;
+    }
+
+    static std::uint64_t container_and_cardinality(const container& a0, const container& b0) {
+        container sa, sb;
+        const container& a = plain(a0, sa);
+        const container& b = plain(b0, sb);
+        std::uint64_t count = 0;
+        if (a.type == kind::bitmap && b.type == kind::bitmap) {
+            for (std::size_t i = 0; i < bitmap_words; ++i) count += static_cast<std::uint64_t>(std::popcount(a.words[i] & b.words[i]));
+        } else if (a.type == kind::bitmap || b.type == kind::bitmap) {
+            const container& bits = a.type == kind::bitmap ? a : b;
+            const container& array = a.type == kind::bitmap ? b : a;
+            for (auto v : array.values) count += bits.words[v >> 6] >> (v & 63) & 1;
+        } else {
+            std::size_t i = 0, j = 0;
+            while (i < a.values.size() && j < b.values.size()) {
+                std::uint16_t x = a.values[i], y = b.values[j];
+                count += x == y;
+                i += x <= y;
+                j += y <= x;
+            }
+        }
+        return count;
+    }
+
+    // Merges two key lists, combining containers present on both sides.
+    // KeepLeft/KeepRight decide whether unmatched containers are copied over.
+    template<bool KeepLeft, bool KeepRight, typename Combine>
+    static roaring_bitmap merge(const roaring_bitmap& a, const roaring_bitmap& b, Combine combine) {
+        roaring_bitmap out;
+        std::size_t i = 0, j = 0;
+        while (i < a.keys.size() || j < b.keys.size()) {
+            if (j == b.keys.size() || (i < a.keys.size() && a.keys[i] < b.keys[j])) {
+                if constexpr (KeepLeft) out.append(a.keys[i], a.containers[i]);
+                ++i;
+            } else if (i == a.keys.size() || b.keys[j] < a.keys[i]) {
+                if constexpr (KeepRight) out.append(b.keys[j], b.containers[j]);
+                ++j;
+            } else {
+                container c = combine(a.containers[i], b.containers[j]);
+                if (c.card) out.append(a.keys[i], std::move(c));
+                ++i;
+                ++j;
+            }
+            if constexpr (!KeepRight) if (i == a.keys.size()) break;
+            if constexpr (!KeepLeft) if (j == b.keys.size()) break;
+        }
+        return out;
+    }
+
+    void append(std::uint16_t key, container c) {
+        keys.push_back(key);
+        containers.push_back(std::move(c));
+    }
+
+    // Index of the container for key, or where it would be inserted
+    std::size_t key_position(std::uint16_t key) const {
+        return static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+    }
+
+    // ---- serialization helpers ----------------------------------------------------
+
+    static constexpr std::uint32_t cookie_no_runs = 12346;
+    static constexpr std::uint32_t cookie_runs = 12347;
+    static constexpr std::size_t no_offset_threshold = 4;
+
+    static void put16(std::vector<std::uint8_t>& out, std::uint16_t v) {
+        out.push_back(static_cast<std::uint8_t>(v));
+        out.push_back(static_cast<std::uint8_t>(v >> 8));
+    }
+
+    static void put32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+        put16(out, static_cast<std::uint16_t>(v));
+        put16(out, static_cast<std::uint16_t>(v >> 16));
+    }
+
+    struct reader {
+        std::span<const std::uint8_t> bytes;
+        std::size_t pos = 0;
+
+        void need(std::size_t n) const {
+            if (bytes.size() - pos < n) throw std::runtime_error("roaring_bitmap: truncated input");
+        }
+        std::uint16_t get16() {
+            need(2);
+            auto v = static_cast<std::uint16_t>(bytes[pos] | bytes[pos + 1] << 8);
+            pos += 2;
+            return v;
+        }
+        std::uint32_t get32() {
+            std::uint32_t lo = get16();
+            return lo | std::uint32_t{get16()} << 16;
+        }
+        std::uint64_t get64() {
+            std::uint64_t lo = get32();
+            return lo | std::uint64_t{get32()} << 32;
+        }
+    };
+
+public:
+    roaring_bitmap() = default;
+
+    roaring_bitmap(std::initializer_list<std::uint32_t> values) {
+        for (auto v : values) add(v);
+    }
+
+    // Builds from sorted or unsorted values one chunk at a time
+    static roaring_bitmap from_range(std::span<const std::uint32_t> values) {
+        std::vector<std::uint32_t> sorted(values.begin(), values.end());
+        std::ranges::sort(sorted);
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        roaring_bitmap out;
+        for (std::size_t i = 0; i < sorted.size();) {
+            auto key = static_cast<std::uint16_t>(sorted[i] >> 16);
+            std::vector<std::uint16_t> low;
+            for (; i < sorted.size() && sorted[i] >> 16 == key; ++i) low.push_back(static_cast<std::uint16_t>(sorted[i]));
+            container c = make_array(std::move(low));
+            normalize(c);
+            out.append(key, std::move(c));
+        }
+        return out;
+    }
+
+    bool contains(std::uint32_t x) const {
+        auto key = static_cast<std::uint16_t>(x >> 16);
+        std::size_t i = key_position(key);
+        return i < keys.size() && keys[i] == key && containers[i].contains(static_cast<std::uint16_t>(x));
+    }
+
+    // Returns false if x was already present
+    bool add(std::uint32_t x) {
+        auto key = static_cast<std::uint16_t>(x >> 16);
+        auto low = static_cast<std::uint16_t>(x);
+        std::size_t i = key_position(key);
+        if (i == keys.size() || keys[i] != key) {
+            keys.insert(keys.begin() + static_cast<std::ptrdiff_t>(i), key);
+            containers.insert(containers.begin() + static_cast<std::ptrdiff_t>(i), make_array({low}));
+            return true;
+        }
+        container& c = containers[i];
+        if (c.contains(low)) return false;
+        if (c.type == kind::run) c = expand_runs(c);
+        if (c.type == kind::array) {
+            c.values.insert(std::lower_bound(c.values.begin(), c.values.end(), low), low);
+            ++c.card;
+            normalize(c);
+        } else {
+            c.words[low >> 6] |= std::uint64_t{1} << (low & 63);
+            ++c.card;
+        }
+        return true;
+    }
+
+    // Returns false if x was absent
+    bool remove(std::uint32_t x) {
+        auto key = static_cast<std::uint16_t>(x >> 16);
+        auto low = static_cast<std::uint16_t>(x);
+        std::size_t i = key_position(key);
+        if (i == keys.size() || keys[i] != key || !containers[i].contains(low)) return false;
+        container& c = containers[i];
+        if (c.type == kind::run) c = expand_runs(c);
+        if (c.type == kind::array) c.values.erase(std::lower_bound(c.values.begin(), c.values.end(), low));
+        else c.words[low >> 6] &= ~(std::uint64_t{1} << (low & 63));
+        --c.card;
+        normalize(c);
+        if (c.card == 0) {
+            keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(i));
+            containers.erase(containers.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        return true;
+    }
+
+    // Adds every value in [lo, hi]; untouched chunks get a single run
+    void add_range(std::uint32_t lo, std::uint32_t hi) {
+        if (hi < lo) throw std::invalid_argument("roaring_bitmap::add_range: hi < lo");
+        for (std::uint32_t key = lo >> 16; key <= hi >> 16; ++key) {
+            std::uint32_t start = key == lo >> 16 ? lo & 0xFFFF : 0;
+            std::uint32_t end = key == hi >> 16 ? hi & 0xFFFF : 0xFFFF;
+            container range;
+            range.type = kind::run;
+            range.card = end - start + 1;
+            range.values = {static_cast<std::uint16_t>(start), static_cast<std::uint16_t>(end - start)};
+
+            auto k16 = static_cast<std::uint16_t>(key);
+            std::size_t i = key_position(k16);
+            if (i == keys.size() || keys[i] != k16) {
+                keys.insert(keys.begin() + static_cast<std::ptrdiff_t>(i), k16);
+                containers.insert(containers.begin() + static_cast<std::ptrdiff_t>(i), std::move(range));
+            } else {
+                containers[i] = container_or(containers[i], range);
+            }
+            if (key == 0xFFFF) break;
+        }
+    }
+
+    // Switches each container to run encoding where that is smaller
+    void run_optimize() {
+        for (auto& c : containers) {
+            if (c.type == kind::run) continue;
+            std::size_t run_bytes = 2 + 4 * count_runs(c);
+            std::size_t plain_bytes = c.type == kind::array ? 2 * std::size_t{c.card} : 8192;
+            if (run_bytes < plain_bytes) c = to_runs(c);
+        }
+    }
+
+    std::uint64_t cardinality() const {
+        std::uint64_t total = 0;
+        for (const auto& c : containers) total += c.card;
+        return total;
+    }
+
+    bool empty() const { return keys.empty(); }
+
+    template<typename F>
+    void for_each(F f) const {
+        for (std::size_t i = 0; i < keys.size(); ++i) containers[i].for_each(std::uint32_t{keys[i]} << 16, f);
+    }
+
+    std::vector<std::uint32_t> to_vector() const {
+        std::vector<std::uint32_t> out;
+        out.reserve(cardinality());
+        for_each([&](std::uint32_t v) { out.push_back(v); });
+        return out;
+    }
+
+    std::size_t memory_bytes() const {
+        std::size_t total = sizeof(*this) + keys.capacity() * sizeof(std::uint16_t);
+        for (const auto& c : containers) total += c.bytes();
+        return total;
+    }
+
+    struct container_stats {
+        std::size_t arrays = 0, bitmaps = 0, runs = 0;
+    };
+
+    container_stats stats() const {
+        container_stats s;
+        for (const auto& c : containers) {
+            if (c.type == kind::array) ++s.arrays;
+            else if (c.type == kind::bitmap) ++s.bitmaps;
+            else ++s.runs;
+        }
+        return s;
+    }
+
+    friend roaring_bitmap operator|(const roaring_bitmap& a, const roaring_bitmap& b) {
+        return merge<true, true>(a, b, container_or);
+    }
+    friend roaring_bitmap operator&(const roaring_bitmap& a, const roaring_bitmap& b) {
+        return merge<false, false>(a, b, container_and);
+    }
+    friend roaring_bitmap operator-(const roaring_bitmap& a, const roaring_bitmap& b) {
+        return merge<true, false>(a, b, container_andnot);
+    }
+    friend roaring_bitmap operator^(const roaring_bitmap& a, const roaring_bitmap& b) {
+        return merge<true, true>(a, b, container_xor);
+    }
+
+    // |a & b| without building the intersection
+    friend std::uint64_t and_cardinality(const roaring_bitmap& a, const roaring_bitmap& b) {
+        std::uint64_t total = 0;
+        std::size_t i = 0, j = 0;
+        while (i < a.keys.size() && j < b.keys.size()) {
+            if (a.keys[i] < b.keys[j]) ++i;
+            else if (b.keys[j] < a.keys[i]) ++j;
+            else total += container_and_cardinality(a.containers[i++], b.containers[j++]);
+        }
+        return total;
+    }
+
+    friend bool operator==(const roaring_bitmap& a, const roaring_bitmap& b) {
+        return a.cardinality() == b.cardinality() && and_cardinality(a, b) == a.cardinality();
+    }
+
+    // Portable Roaring format (little-endian), readable by CRoaring/Java/Go
+    std::vector<std::uint8_t> serialize() const {
+        const std::size_t n = keys.size();
+        bool has_runs = std::ranges::any_of(containers, [](const container& c) { return c.type == kind::run; });
+        std::vector<std::uint8_t> out;
+
+        if (has_runs) {
+            put32(out, cookie_runs | static_cast<std::uint32_t>(n - 1) << 16);
+            std::vector<std::uint8_t> run_flags((n + 7) / 8);
+            for (std::size_t i = 0; i < n; ++i)
+                if (containers[i].type == kind::run) run_flags[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+            out.insert(out.end(), run_flags.begin(), run_flags.end());
+        } else {
+            put32(out, cookie_no_runs);
+            put32(out, static_cast<std::uint32_t>(n));
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            put16(out, keys[i]);
+            put16(out, static_cast<std::uint16_t>(containers[i].card - 1));
+        }
+
+        bool with_offsets = !has_runs || n >= no_offset_threshold;
+        std::size_t offset_pos = out.size();
+        if (with_offsets) out.resize(out.size() + 4 * n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (with_offsets) {
+                auto off = static_cast<std::uint32_t>(out.size());
+                for (int b = 0; b < 4; ++b) out[offset_pos + 4 * i + b] = static_cast<std::uint8_t>(off >> (8 * b));
+            }
+            const container& c = containers[i];
+            if (c.type == kind::run) {
+                put16(out, static_cast<std::uint16_t>(c.values.size() / 2));
+                for (auto v : c.values) put16(out, v);
+            } else if (c.type == kind::array) {
+                for (auto v : c.values) put16(out, v);
+            } else {
+                for (auto w : c.words) {
+                    put32(out, static_cast<std::uint32_t>(w));
+                    put32(out, static_cast<std::uint32_t>(w >> 32));
+                }
+            }
+        }
+        return out;
+    }
+
+    static roaring_bitmap deserialize(std::span<const std::uint8_t> bytes) {
+        reader in{bytes};
+        std::uint32_t cookie = in.get32();
+        std::size_t n;
+        std::vector<std::uint8_t> run_flags;
+        bool has_runs = (cookie & 0xFFFF) == cookie_runs;
+        if (has_runs) {
+            n = (cookie >> 16) + 1;
+            in.need((n + 7) / 8);
+            run_flags.assign(bytes.begin() + static_cast<std::ptrdiff_t>(in.pos),
+                             bytes.begin() + static_cast<std::ptrdiff_t>(in.pos + (n + 7) / 8));
+            in.pos += run_flags.size();
+        } else if (cookie == cookie_no_runs) {
+            n = in.get32();
+            if (n > 65536) throw std::runtime_error("roaring_bitmap: too many containers");
+        } else {
+            throw std::runtime_error("roaring_bitmap: bad cookie");
+        }
+
+        roaring_bitmap out;
+        std::vector<std::uint32_t> cards(n);
+        out.keys.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            out.keys[i] = in.get16();
+            cards[i] = std::uint32_t{in.get16()} + 1;
+            if (i > 0 && out.keys[i] <= out.keys[i - 1]) throw std::runtime_error("roaring_bitmap: keys not ascending");
+        }
+        if (!has_runs || n >= no_offset_threshold) {
+            in.need(4 * n);
+            in.pos += 4 * n;  // Containers are read sequentially, so offsets are only skipped
+        }
+
+        out.containers.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            container& c = out.containers[i];
+            if (has_runs && (run_flags[i / 8] >> (i % 8) & 1)) {
+                c.type = kind::run;
+                std::size_t runs = in.get16();
+                c.values.resize(2 * runs);
+                std::uint32_t total = 0;
+                for (auto& v : c.values) v = in.get16();
+                for (std::size_t r = 0; r < runs; ++r) {
+                    if (std::uint32_t{c.values[2 * r]} + c.values[2 * r + 1] > 0xFFFF ||
+                        (r > 0 && c.values[2 * r] <= std::uint32_t{c.values[2 * r - 2]} + c.values[2 * r - 1]))
+                        throw std::runtime_error("roaring_bitmap: malformed run container");
+                    total += std::uint32_t{c.values[2 * r + 1]} + 1;
+                }
+                c.card = total;
+            } else if (cards[i] <= array_max) {
+                c.values.resize(cards[i]);
+                for (auto& v : c.values) v = in.get16();
+                if (!std::ranges::is_sorted(c.values) ||
+                    std::adjacent_find(c.values.begin(), c.values.end()) != c.values.end())
+                    throw std::runtime_error("roaring_bitmap: malformed array container");
+                c.card = cards[i];
+            } else {
+                c.type = kind::bitmap;
+                c.words.resize(bitmap_words);
+                for (auto& w : c.words) w = in.get64();
+                c.card = count_words(c.words.data());
+            }
+            if (c.card != cards[i]) throw std::runtime_error("roaring_bitmap: cardinality mismatch");
+        }
+        return out;
+    }
+};
+
+void demonstrate_roaring() {
+    std::cout << "\n=== ROARING BITMAP ===\n";
+
+    // The sets from cpp26_set::demonstrate_set_algorithms
+    roaring_bitmap a = {1, 2, 3, 4, 5};
+    roaring_bitmap b = {3, 4, 5, 6, 7};
+    auto show = [](const char* label, const roaring_bitmap& r) {
+        std::cout << label;
+        r.for_each([](std::uint32_t v) { std::cout << v << " "; });
+        std::cout << "\n";
+    };
+    show("A | B: ", a | b);
+    show("A & B: ", a & b);
+    show("A - B: ", a - b);
+    show("A ^ B: ", a ^ b);
+    std::cout << std::format("|A & B| = {} (no intermediate set)\n", and_cardinality(a, b));
+
+    // One chunk of each container kind
+    roaring_bitmap mixed;
+    for (std::uint32_t v = 0; v < 100; ++v) mixed.add(v * 7);                   // sparse -> array
+    for (std::uint32_t v = 0; v < 20000; ++v) mixed.add((1u << 16) + v * 3);   // dense -> bitmap
+    mixed.add_range(5u << 16, (5u << 16) + 50000);                              // range -> run
+    auto s = mixed.stats();
+    std::cout << std::format("Mixed: {} values in {} arrays, {} bitmaps, {} runs, {} bytes\n",
+                             mixed.cardinality(), s.arrays, s.bitmaps, s.runs, mixed.memory_bytes());
+    std::cout << std::format("contains(693)={}, contains(694)={}, contains(5<<16 | 777)={}\n",
+                             mixed.contains(693), mixed.contains(694), mixed.contains((5u << 16) | 777));
+
+    auto bytes = mixed.serialize();
+    auto restored = roaring_bitmap::deserialize(bytes);
+    std::cout << std::format("Serialized to {} bytes, round trip equal: {}\n", bytes.size(), restored == mixed);
+}
+
+// ============================================================================
+// BENCHMARK - std::set / std::unordered_set vs roaring_bitmap posting lists
+// ============================================================================
+void demonstrate_roaring_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== ROARING BITMAP BENCHMARK ===\n";
+
+    const std::size_t n = scaled(1'000'000);
+    const std::uint32_t universe = static_cast<std::uint32_t>(std::min<std::size_t>(n * 16, UINT32_MAX));
+    SplitMix64 rng(2024);
+    std::vector<std::uint32_t> xs(n), ys(n);
+    for (auto& v : xs) v = static_cast<std::uint32_t>(rng.next() % universe);
+    for (auto& v : ys) v = static_cast<std::uint32_t>(rng.next() % universe);
+
+    std::set<std::uint32_t> set_x(xs.begin(), xs.end()), set_y(ys.begin(), ys.end());
+    std::unordered_set<std::uint32_t> hash_x(xs.begin(), xs.end());
+    roaring_bitmap rx, ry;
+    print_result("roaring from_range", time_ms([&] {
+        rx = roaring_bitmap::from_range(xs);
+        ry = roaring_bitmap::from_range(ys);
+    }), 2 * n);
+
+    // Node estimates: rb-tree node = 32-byte header + value; hash node = next + value, plus bucket
+    double set_bytes = static_cast<double>(set_x.size() * (32 + 8));
+    double hash_bytes = static_cast<double>(hash_x.size() * 16 + hash_x.bucket_count() * 8);
+    std::cout << std::format("{} ids in [0, {}): bytes per id: std::set ~{:.1f}, unordered_set ~{:.1f}, roaring {:.2f}\n",
+                             set_x.size(), universe, set_bytes / set_x.size(), hash_bytes / hash_x.size(),
+                             static_cast<double>(rx.memory_bytes()) / rx.cardinality());
+
+    std::vector<std::uint32_t> out;
+    print_result("std::set_intersection (sets)", best_of_ms(3, [&] {
+        out.clear();
+        std::set_intersection(set_x.begin(), set_x.end(), set_y.begin(), set_y.end(), std::back_inserter(out));
+    }), n);
+    std::size_t std_and = out.size();
+    roaring_bitmap result;
+    print_result("roaring operator&", best_of_ms(3, [&] { result = rx & ry; }), n);
+    std::size_t roaring_and = result.cardinality();
+    print_result("roaring and_cardinality", best_of_ms(3, [&] { do_not_optimize(and_cardinality(rx, ry)); }), n);
+
+    print_result("std::set_union (sets)", best_of_ms(3, [&] {
+        out.clear();
+        std::set_union(set_x.begin(), set_x.end(), set_y.begin(), set_y.end(), std::back_inserter(out));
+    }), n);
+    std::size_t std_or = out.size();
+    print_result("roaring operator|", best_of_ms(3, [&] { result = rx | ry; }), n);
+    std::size_t roaring_or = result.cardinality();
+    print_result("roaring operator-", best_of_ms(3, [&] { result = rx - ry; }), n);
+    std::cout << std::format("  |X & Y| {} / {}, |X | Y| {} / {}\n", std_and, roaring_and, std_or, roaring_or);
+
+    std::size_t hits = 0;
+    print_result("std::set contains", best_of_ms(3, [&] {
+        hits = 0;
+        for (auto v : ys) hits += set_x.count(v);
+        do_not_optimize(hits);
+    }), n);
+    print_result("roaring contains", best_of_ms(3, [&] {
+        hits = 0;
+        for (auto v : ys) hits += rx.contains(v);
+        do_not_optimize(hits);
+    }), n);
+
+    // Posting lists with long consecutive stretches collapse into runs
+    roaring_bitmap ranges;
+    for (std::uint32_t i = 0; i < n / 1000; ++i) ranges.add_range(i * 20000, i * 20000 + 999);
+    for (std::uint32_t i = 0; i < n / 1000; ++i) ranges.add(i * 20000 + 5000);
+    std::size_t before = ranges.serialize().size();
+    ranges.run_optimize();
+    std::cout << std::format("  {} ids in {} ranges: serialized {} bytes, {} after run_optimize\n",
+                             ranges.cardinality(), n / 1000, before, ranges.serialize().size());
+}
+
+void run_all_demos() {
+    demonstrate_roaring();
+    demonstrate_roaring_benchmark();
+}
+
+} // namespace cpp26_roaring
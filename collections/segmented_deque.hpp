@@ -0,0 +1,490 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <span>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <iterator>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_segmented_deque {
+
+// ============================================================================
+// SEGMENTED DEQUE - Deque with a compile-time block size and bulk operations
+// Elements live in fixed BlockSize-element blocks addressed through a ring of
+// block pointers. Unlike std::deque (512-byte blocks in libstdc++), the block
+// size is a template knob, segments are exposed as spans, and emptied blocks
+// are kept for reuse instead of going back to the allocator.
+// Reference: https://en.cppreference.com/w/cpp/container/deque
+// ============================================================================
+template<typename T, std::size_t BlockSize = std::max<std::size_t>(16, 4096 / sizeof(T))>
+class segmented_deque {
+private:
+    static_assert(BlockSize > 0, "BlockSize must be positive");
+
+    std::vector<T*> map;          // Ring of block pointers, power-of-two capacity
+    std::size_t map_head = 0;     // Ring index of the first block in use
+    std::size_t used_blocks = 0;
+    std::size_t start = 0;        // Offset of front() inside the first block
+    std::size_t count = 0;
+    T* tail = nullptr;            // Next back slot, cached so push_back skips the map
+    T* tail_end = nullptr;
+
+    std::vector<T*> spare;        // Recycled empty blocks
+    std::size_t max_spare = 4;
+
+    static T* allocate_block() {
+        return static_cast<T*>(::operator new(sizeof(T) * BlockSize, std::align_val_t{alignof(T)}));
+    }
+
+    static void free_block(T* block) {
+        ::operator delete(block, std::align_val_t{alignof(T)});
+    }
+
+    T* acquire_block() {
+        if (spare.empty()) return allocate_block();
+        T* block = spare.back();
+        spare.pop_back();
+        return block;
+    }
+
+    void recycle_block(T* block) {
+        if (spare.size() < max_spare) spare.push_back(block);
+        else free_block(block);
+    }
+
+    T*& block_at(std::size_t b) { return map[(map_head + b) & (map.size() - 1)]; }
+    T* block_at(std::size_t b) const { return map[(map_head + b) & (map.size() - 1)]; }
+
+    // Unrolls the ring into a map twice as large (at least min_blocks)
+    void grow_map(std::size_t min_blocks) {
+        std::size_t capacity = std::max<std::size_t>(map.size() * 2, 8);
+        while (capacity < min_blocks) capacity *= 2;
+        std::vector<T*> bigger(capacity, nullptr);
+        for (std::size_t b = 0; b < used_blocks; ++b) bigger[b] = block_at(b);
+        map = std::move(bigger);
+        map_head = 0;
+    }
+
+    // Re-derives the cached back cursor after any change to count or the blocks
+    void sync_tail() {
+        std::size_t pos = start + count;
+        if (pos < used_blocks * BlockSize) {
+            T* block = block_at(pos / BlockSize);
+            tail = block + pos % BlockSize;
+            tail_end = block + BlockSize;
+        } else {
+            tail = tail_end = nullptr;
+        }
+    }
+
+    // Ensures blocks exist for positions [start, start + count + n)
+    void reserve_back(std::size_t n) {
+        std::size_t needed = (start + count + n + BlockSize - 1) / BlockSize;
+        if (needed > map.size()) grow_map(needed);
+        while (used_blocks < needed) {
+            block_at(used_blocks) = acquire_block();
+            ++used_blocks;
+        }
+        sync_tail();
+    }
+
+    void release_front_block() {
+        recycle_block(block_at(0));
+        map_head = (map_head + 1) & (map.size() - 1);
+        --used_blocks;
+        start = 0;
+    }
+
+    void release_back_blocks() {
+        std::size_t needed = (start + count + BlockSize - 1) / BlockSize;
+        while (used_blocks > needed) {
+            --used_blocks;
+            recycle_block(block_at(used_blocks));
+        }
+        if (count == 0) start = 0;
+        sync_tail();
+    }
+
+    T* slot(std::size_t i) const {
+        std::size_t pos = start + i;
+        return block_at(pos / BlockSize) + pos % BlockSize;
+    }
+
+    std::span<T> segment_span(std::size_t s) const {
+        std::size_t first = s == 0 ? start : 0;
+        std::size_t last = std::min(BlockSize, start + count - s * BlockSize);
+        return {block_at(s) + first, last - first};
+    }
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class segmented_deque;
+        template<bool> friend class basic_iterator;
+        const segmented_deque* owner = nullptr;
+        std::size_t index = 0;
+
+        basic_iterator(const segmented_deque* d, std::size_t i) : owner(d), index(i) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(owner, index); }
+
+        reference operator*() const { return *owner->slot(index); }
+        pointer operator->() const { return owner->slot(index); }
+        reference operator[](difference_type n) const { return *owner->slot(index + n); }
+
+        basic_iterator& operator++() { ++index; return *this; }
+        basic_iterator& operator--() { --index; return *this; }
+        basic_iterator operator++(int) { auto tmp = *this; ++index; return tmp; }
+        basic_iterator operator--(int) { auto tmp = *this; --index; return tmp; }
+        basic_iterator& operator+=(difference_type n) { index += n; return *this; }
+        basic_iterator& operator-=(difference_type n) { index -= n; return *this; }
+        friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) { return it += n; }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        bool operator==(const basic_iterator& other) const { return index == other.index; }
+        auto operator<=>(const basic_iterator& other) const { return index <=> other.index; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    segmented_deque() = default;
+    segmented_deque(const segmented_deque&) = delete;
+    segmented_deque& operator=(const segmented_deque&) = delete;
+
+    ~segmented_deque() {
+        clear();
+        for (T* block : spare) free_block(block);
+    }
+
+    static constexpr std::size_t block_size() { return BlockSize; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, count); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::size_t blocks() const { return used_blocks; }
+    std::size_t spare_blocks() const { return spare.size(); }
+
+    // How many emptied blocks to keep around for reuse
+    void set_max_spare(std::size_t n) {
+        max_spare = n;
+        while (spare.size() > max_spare) {
+            free_block(spare.back());
+            spare.pop_back();
+        }
+    }
+
+    T& operator[](std::size_t i) { return *slot(i); }
+    const T& operator[](std::size_t i) const { return *slot(i); }
+
+    T& at(std::size_t i) {
+        if (i >= count) throw std::out_of_range("segmented_deque::at");
+        return *slot(i);
+    }
+    const T& at(std::size_t i) const {
+        if (i >= count) throw std::out_of_range("segmented_deque::at");
+        return *slot(i);
+    }
+
+    T& front() { return *slot(0); }
+    T& back() { return *slot(count - 1); }
+    const T& front() const { return *slot(0); }
+    const T& back() const { return *slot(count - 1); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (tail == tail_end) reserve_back(1);
+        T* p = ::new (static_cast<void*>(tail)) T(std::forward<Args>(args)...);
+        ++tail;
+        ++count;
+        return *p;
+    }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (start == 0) {
+            if (used_blocks == map.size()) grow_map(used_blocks + 1);
+            map_head = (map_head - 1) & (map.size() - 1);
+            block_at(0) = acquire_block();
+            ++used_blocks;
+            start = BlockSize;
+        }
+        T* p;
+        try {
+            p = ::new (static_cast<void*>(block_at(0) + start - 1)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (start == BlockSize) release_front_block();
+            throw;
+        }
+        --start;
+        ++count;
+        return *p;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    void pop_front() {
+        std::destroy_at(block_at(0) + start);
+        ++start;
+        --count;
+        if (start == BlockSize) release_front_block();
+        if (count == 0) release_back_blocks();
+    }
+
+    void pop_back() {
+        std::destroy_at(slot(count - 1));
+        --count;
+        release_back_blocks();
+    }
+
+    // Copies a whole range block by block: one capacity check, then bulk copies
+    template<std::ranges::input_range R>
+    void append_range(R&& range) {
+        if constexpr (std::ranges::sized_range<R>) {
+            auto n = static_cast<std::size_t>(std::ranges::size(range));
+            reserve_back(n);
+            auto it = std::ranges::begin(range);
+            std::size_t remaining = n;
+            while (remaining > 0) {
+                std::size_t pos = start + count;
+                std::size_t chunk = std::min(remaining, BlockSize - pos % BlockSize);
+                T* dst = block_at(pos / BlockSize) + pos % BlockSize;
+                it = std::ranges::uninitialized_copy_n(it, chunk, dst, dst + chunk).in;
+                count += chunk;
+                remaining -= chunk;
+            }
+            sync_tail();
+        } else {
+            for (auto&& x : range) emplace_back(std::forward<decltype(x)>(x));
+        }
+    }
+
+    // Destroys the first n elements a block at a time and recycles emptied blocks
+    void pop_front_n(std::size_t n) {
+        if (n > count) throw std::out_of_range("segmented_deque::pop_front_n");
+        while (n > 0) {
+            std::size_t chunk = std::min(n, BlockSize - start);
+            std::destroy_n(block_at(0) + start, chunk);
+            start += chunk;
+            count -= chunk;
+            n -= chunk;
+            if (start == BlockSize) release_front_block();
+        }
+        if (count == 0) release_back_blocks();
+    }
+
+    void clear() {
+        pop_front_n(count);
+        release_back_blocks();
+    }
+
+    // Contiguous pieces of the deque, front to back
+    std::size_t segment_count() const {
+        return count == 0 ? 0 : (start + count - 1) / BlockSize + 1;
+    }
+
+    std::span<T> segment(std::size_t s) { return segment_span(s); }
+    std::span<const T> segment(std::size_t s) const { return segment_span(s); }
+
+    template<typename F>
+    void for_each_segment(F f) {
+        for (std::size_t s = 0, n = segment_count(); s < n; ++s) f(segment(s));
+    }
+    template<typename F>
+    void for_each_segment(F f) const {
+        for (std::size_t s = 0, n = segment_count(); s < n; ++s) f(segment(s));
+    }
+};
+
+// ============================================================================
+// RING BUFFER - Power-of-two circular buffer used as the FIFO baseline
+// ============================================================================
+template<typename T>
+class ring_buffer {
+private:
+    std::vector<T> buffer;
+    std::size_t head = 0;
+    std::size_t count = 0;
+
+    void grow() {
+        std::vector<T> bigger(std::max<std::size_t>(buffer.size() * 2, 16));
+        for (std::size_t i = 0; i < count; ++i) bigger[i] = std::move(buffer[(head + i) & (buffer.size() - 1)]);
+        buffer = std::move(bigger);
+        head = 0;
+    }
+
+public:
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& front() { return buffer[head]; }
+
+    void push_back(const T& value) {
+        if (count == buffer.size()) grow();
+        buffer[(head + count++) & (buffer.size() - 1)] = value;
+    }
+
+    void pop_front() {
+        head = (head + 1) & (buffer.size() - 1);
+        --count;
+    }
+};
+
+void demonstrate_segmented_deque() {
+    std::cout << "\n=== SEGMENTED DEQUE ===\n";
+
+    segmented_deque<int, 4> dq;  // Tiny blocks so the segments are visible
+    for (int i = 1; i <= 6; ++i) dq.push_back(i);
+    dq.push_front(0);
+    dq.push_front(-1);
+
+    auto print_segments = [&](const char* label) {
+        std::cout << label;
+        dq.for_each_segment([](std::span<int> seg) {
+            std::cout << "[";
+            for (std::size_t i = 0; i < seg.size(); ++i) std::cout << (i ? " " : "") << seg[i];
+            std::cout << "] ";
+        });
+        std::cout << std::format("(size {}, {} blocks, {} spare)\n", dq.size(), dq.blocks(), dq.spare_blocks());
+    };
+    print_segments("After push_back 1..6, push_front 0,-1: ");
+
+    std::vector<int> batch = {7, 8, 9, 10, 11};
+    dq.append_range(batch);
+    print_segments("After append_range(7..11):             ");
+
+    dq.pop_front_n(6);
+    print_segments("After pop_front_n(6):                  ");
+
+    dq.pop_back();
+    std::cout << std::format("front={}, back={}, dq[2]={}, at(1)={}\n", dq.front(), dq.back(), dq[2], dq.at(1));
+    std::cout << "Sorted descending via random-access iterators: ";
+    std::sort(dq.begin(), dq.end(), std::greater<>());
+    for (int x : dq) std::cout << x << " ";
+    std::cout << "\n";
+
+    try {
+        dq.at(100);
+    } catch (const std::out_of_range& e) {
+        std::cout << "at(100) threw: " << e.what() << "\n";
+    }
+
+    // Segments are plain spans, so per-segment loops vectorize
+    segmented_deque<double> values;
+    values.append_range(std::views::iota(0, 10000) | std::views::transform([](int i) { return i * 0.5; }));
+    double total = 0;
+    values.for_each_segment([&](std::span<double> seg) { total += std::accumulate(seg.begin(), seg.end(), 0.0); });
+    std::cout << std::format("Default block size for double: {} elements; sum over {} segments = {}\n",
+                             values.block_size(), values.segment_count(), total);
+}
+
+// ============================================================================
+// FIFO BENCHMARK - std::deque vs segmented_deque vs ring buffer
+// Steady-state queue: every round pushes a batch and pops a batch.
+// ============================================================================
+void demonstrate_segmented_deque_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== SEGMENTED DEQUE FIFO BENCHMARK ===\n";
+
+    using Value = std::uint64_t;
+    const std::size_t depth = 1 << 16;
+    const std::size_t batch = 256;
+    const std::size_t rounds = scaled(4096);
+    const std::size_t ops = rounds * batch;
+    std::vector<Value> input(batch);
+    std::iota(input.begin(), input.end(), Value{1});
+
+    auto single = [&](auto& q) {
+        for (std::size_t i = 0; i < depth; ++i) q.push_back(i);
+        Value sum = 0;
+        for (std::size_t r = 0; r < rounds; ++r)
+            for (std::size_t i = 0; i < batch; ++i) {
+                q.push_back(input[i]);
+                sum += q.front();
+                q.pop_front();
+            }
+        do_not_optimize(sum);
+    };
+
+    std::cout << std::format("push_back + pop_front, depth {}:\n", depth);
+    print_result("std::deque", time_ms([&] { std::deque<Value> q; single(q); }), ops);
+    print_result("segmented_deque<64> (512 B blocks)",
+                 time_ms([&] { segmented_deque<Value, 64> q; single(q); }), ops);
+    print_result("segmented_deque<512> (4 KiB blocks)",
+                 time_ms([&] { segmented_deque<Value> q; single(q); }), ops);
+    print_result("ring_buffer", time_ms([&] { ring_buffer<Value> q; single(q); }), ops);
+
+    std::cout << std::format("bulk: {} in / {} out per round:\n", batch, batch);
+    print_result("std::deque insert/erase", time_ms([&] {
+        std::deque<Value> q(depth);
+        for (std::size_t r = 0; r < rounds; ++r) {
+            q.insert(q.end(), input.begin(), input.end());
+            q.erase(q.begin(), q.begin() + batch);
+        }
+        do_not_optimize(q.front());
+    }), ops);
+    print_result("segmented_deque append/pop_n", time_ms([&] {
+        segmented_deque<Value> q;
+        q.append_range(std::vector<Value>(depth));
+        for (std::size_t r = 0; r < rounds; ++r) {
+            q.append_range(input);
+            q.pop_front_n(batch);
+        }
+        do_not_optimize(q.front());
+    }), ops);
+
+    const std::size_t n = scaled(1 << 22);
+    std::deque<Value> std_dq(n, 1);
+    segmented_deque<Value> seg_dq;
+    seg_dq.append_range(std::vector<Value>(n, 1));
+    std::cout << std::format("sum of {} elements:\n", n);
+    print_result("std::deque iterators", best_of_ms(3, [&] {
+        do_not_optimize(std::accumulate(std_dq.begin(), std_dq.end(), Value{0}));
+    }), n);
+    print_result("segmented_deque spans", best_of_ms(3, [&] {
+        Value sum = 0;
+        seg_dq.for_each_segment([&](std::span<Value> seg) {
+            for (Value v : seg) sum += v;
+        });
+        do_not_optimize(sum);
+    }), n);
+}
+
+void run_all_demos() {
+    demonstrate_segmented_deque();
+    demonstrate_segmented_deque_benchmark();
+}
+
+} // namespace cpp26_segmented_deque
@@ -5,6 +5,9 @@
 #include <algorithm>
 #include <format>
 #include <vector>
+#include <memory_resource>
+#include <array>
+#include <cstddef>
 
 namespace cpp26_set {
 
@@ -319,6 +322,33 @@ void demonstrate_custom_comparator() {
     std::cout << "\n";
 }
 
+// ============================================================================
+// PMR SET - std::pmr::set with nodes carved from a local buffer (C++17)
+// ============================================================================
+void demonstrate_set_pmr() {
+    std::cout << "\n=== PMR SET (Monotonic Buffer) ===\n";
+
+    // Every tree node is carved from the local buffer; with a null upstream
+    // the set can never touch the heap
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource pool(buffer.data(), buffer.size(),
+                                             std::pmr::null_memory_resource());
+
+    std::pmr::set<int> s(&pool);
+    for (int x : {5, 2, 8, 2, 1, 9, 7}) s.insert(x);
+
+    std::cout << "pmr::set: ";
+    for (auto x : s) std::cout << x << " ";
+    std::cout << "\n";
+
+    // Erased nodes are not reused by a monotonic resource; pick
+    // unsynchronized_pool_resource for churn-heavy sets
+    s.erase(8);
+    s.insert(8);
+    std::cout << std::format("After erase(8) + insert(8): size={}\n", s.size());
+    std::cout << std::format("Resource is pool: {}\n", s.get_allocator().resource() == &pool);
+}
+
 void run_all_demos() {
     demonstrate_set();
     demonstrate_multiset();
@@ -327,6 +357,7 @@ void run_all_demos() {
     demonstrate_set_algorithms();
     demonstrate_set_operations();
     demonstrate_custom_comparator();
+    demonstrate_set_pmr();
 }
 
 } // namespace cpp26_set
@@ -0,0 +1,492 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <array>
+#include <bit>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_set_kernels {
+
+// ============================================================================
+// SORTED-SET KERNELS - Intersection and union of sorted integer arrays
+// Inputs are strictly increasing arrays of 32- or 64-bit integers (set
+// semantics, as produced by std::set or sort + unique).
+//   merge     - scalar two-pointer walk, advancing both sides without branches
+//               on the comparison
+//   galloping - exponential + binary search of the large side for each
+//               element of the small side: O(small * log(large / small))
+//   simd      - AVX2 block compare: each 8-lane (4-lane for 64-bit) block of
+//               A is compared with every rotation of a block of B, matches
+//               are compacted with a permutation table; union merges blocks
+//               with a bitonic min/max network and drops duplicates in-register
+// intersect()/union_of() pick the strategy from the size ratio. All writers
+// store exactly the result (masked stores), so out needs only the usual
+// std::set_intersection/std::set_union capacity.
+// Reference: https://en.cppreference.com/w/cpp/algorithm/set_intersection
+// ============================================================================
+
+template<typename T>
+concept set_word = std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+// Beyond this size ratio galloping beats any linear walk
+inline constexpr std::size_t galloping_ratio = 32;
+
+// ---- scalar kernels --------------------------------------------------------
+
+template<set_word T, bool CountOnly = false>
+std::size_t intersect_merge(std::span<const T> a, std::span<const T> b, T* out = nullptr) {
+    std::size_t i = 0, j = 0, count = 0;
+    while (i < a.size() && j < b.size()) {
+        T x = a[i], y = b[j];
+        if (x == y) {
+            if constexpr (!CountOnly) out[count] = x;
+            ++count;
+        }
+        i += x <= y;
+        j += y <= x;
+    }
+    return count;
+}
+
+template<set_word T, bool CountOnly = false>
+std::size_t intersect_galloping(std::span<const T> small, std::span<const T> large, T* out = nullptr) {
+    std::size_t count = 0, lo = 0;
+    for (T x : small) {
+        // Gallop from the last match point, then binary search the bracket
+        std::size_t step = 1, hi = lo;
+        while (hi < large.size() && large[hi] < x) {
+            lo = hi + 1;
+            hi += step;
+            step *= 2;
+        }
+        hi = std::min(hi, large.size());
+        lo = static_cast<std::size_t>(std::lower_bound(large.begin() + lo, large.begin() + hi, x) - large.begin());
+        if (lo == large.size()) break;
+        if (large[lo] == x) {
+            if constexpr (!CountOnly) out[count] = x;
+            ++count;
+        }
+    }
+    return count;
+}
+
+// Union of two strictly increasing arrays. has_last/last name a value
+// already written by the caller (the SIMD path finishes with this), which
+// is skipped if it reappears at the front of either input.
+template<set_word T>
+std::size_t union_merge(std::span<const T> a, std::span<const T> b, T* out, bool has_last = false, T last = 0) {
+    std::size_t i = 0, j = 0, count = 0;
+    if (has_last) {
+        i = !a.empty() && a[0] == last;
+        j = !b.empty() && b[0] == last;
+    }
+    while (i < a.size() && j < b.size()) {
+        T x = a[i], y = b[j];
+        out[count++] = x < y ? x : y;
+        i += x <= y;
+        j += y <= x;
+    }
+    out = std::copy(a.begin() + static_cast<std::ptrdiff_t>(i), a.end(), out + count);
+    std::copy(b.begin() + static_cast<std::ptrdiff_t>(j), b.end(), out);
+    return count + (a.size() - i) + (b.size() - j);
+}
+
+// ---- AVX2 kernels ----------------------------------------------------------
+
+#if defined(__AVX2__)
+namespace detail {
+
+// Lane indices that move the lanes selected by an 8-bit mask to the front,
+// packed one byte per lane and widened with vpmovzxbd
+inline constexpr auto compress32_table = [] {
+    std::array<std::uint64_t, 256> table{};
+    for (unsigned mask = 0; mask < 256; ++mask) {
+        unsigned out = 0;
+        for (unsigned lane = 0; lane < 8; ++lane)
+            if (mask >> lane & 1) table[mask] |= std::uint64_t{lane} << (8 * out++);
+    }
+    return table;
+}();
+
+// Same for four 64-bit lanes, expressed as pairs of 32-bit lanes
+inline constexpr auto compress64_table = [] {
+    std::array<std::uint64_t, 16> table{};
+    for (unsigned mask = 0; mask < 16; ++mask) {
+        unsigned out = 0;
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            if (mask >> lane & 1) {
+                table[mask] |= std::uint64_t{2 * lane} << (8 * out++);
+                table[mask] |= std::uint64_t{2 * lane + 1} << (8 * out++);
+            }
+        }
+    }
+    return table;
+}();
+
+inline __m256i load_permutation(std::uint64_t packed) {
+    return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(packed)));
+}
+
+// Writes the first count 32-bit lanes of v without touching memory past them
+inline void store_prefix32(void* out, __m256i v, unsigned count) {
+    __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    _mm256_maskstore_epi32(static_cast<int*>(out), keep, v);
+}
+
+inline unsigned match_mask32(__m256i va, __m256i vb) {
+    const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    __m256i hits = _mm256_cmpeq_epi32(va, vb);
+    for (int r = 1; r < 8; ++r) {
+        vb = _mm256_permutevar8x32_epi32(vb, rotate);
+        hits = _mm256_or_si256(hits, _mm256_cmpeq_epi32(va, vb));
+    }
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(hits)));
+}
+
+inline unsigned match_mask64(__m256i va, __m256i vb) {
+    __m256i hits = _mm256_cmpeq_epi64(va, vb);
+    for (int r = 1; r < 4; ++r) {
+        vb = _mm256_permute4x64_epi64(vb, 0x39);
+        hits = _mm256_or_si256(hits, _mm256_cmpeq_epi64(va, vb));
+    }
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(hits)));
+}
+
+template<typename T>
+__m256i vmin(__m256i a, __m256i b) {
+    if constexpr (std::is_signed_v<T>) return _mm256_min_epi32(a, b);
+    else return _mm256_min_epu32(a, b);
+}
+
+template<typename T>
+__m256i vmax(__m256i a, __m256i b) {
+    if constexpr (std::is_signed_v<T>) return _mm256_max_epi32(a, b);
+    else return _mm256_max_epu32(a, b);
+}
+
+// Sorts a bitonic 8-lane vector: compare-exchange at distance 4, 2, 1
+template<typename T>
+__m256i bitonic_clean(__m256i v) {
+    __m256i p = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(vmin<T>(v, p), vmax<T>(v, p), 0xF0);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(vmin<T>(v, p), vmax<T>(v, p), 0xCC);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_blend_epi32(vmin<T>(v, p), vmax<T>(v, p), 0xAA);
+}
+
+// Merges two sorted vectors into the 8 smallest (lo) and 8 largest (hi)
+template<typename T>
+void merge8(__m256i a, __m256i b, __m256i& lo, __m256i& hi) {
+    b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    lo = bitonic_clean<T>(vmin<T>(a, b));
+    hi = bitonic_clean<T>(vmax<T>(a, b));
+}
+
+} // namespace detail
+
+template<set_word T, bool CountOnly = false>
+std::size_t intersect_simd(std::span<const T> a, std::span<const T> b, T* out = nullptr) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    std::size_t i = 0, j = 0, count = 0;
+    while (i + lanes <= a.size() && j + lanes <= b.size()) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data() + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b.data() + j));
+        unsigned mask = sizeof(T) == 4 ? detail::match_mask32(va, vb) : detail::match_mask64(va, vb);
+        auto hits = static_cast<unsigned>(std::popcount(mask));
+        if constexpr (!CountOnly) {
+            if (hits) {
+                std::uint64_t perm = sizeof(T) == 4 ? detail::compress32_table[mask] : detail::compress64_table[mask];
+                __m256i packed = _mm256_permutevar8x32_epi32(va, detail::load_permutation(perm));
+                detail::store_prefix32(out + count, packed, hits * static_cast<unsigned>(sizeof(T) / 4));
+            }
+        }
+        count += hits;
+        // Retire whichever block ends first (both when they end on the same value)
+        T amax = a[i + lanes - 1], bmax = b[j + lanes - 1];
+        i += amax <= bmax ? lanes : 0;
+        j += bmax <= amax ? lanes : 0;
+    }
+    return count + intersect_merge<T, CountOnly>(a.subspan(i), b.subspan(j), CountOnly ? nullptr : out + count);
+}
+
+// Vectorized union for 32-bit keys (AVX2 has no 64-bit min/max)
+template<set_word T>
+std::size_t union_simd(std::span<const T> a, std::span<const T> b, T* out) {
+    if constexpr (sizeof(T) != 4) {
+        return union_merge(a, b, out);
+    } else {
+        if (a.size() < 8 || b.size() < 8) return union_merge(a, b, out);
+        auto load = [](const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); };
+        const __m256i shift_up = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+        std::size_t i = 8, j = 8, count = 0;
+        bool has_last = false;
+        T last = 0;
+        __m256i lo, hi;
+        detail::merge8<T>(load(a.data()), load(b.data()), lo, hi);
+        for (;;) {
+            // Keep lanes that differ from their predecessor (lane 0 vs the last value written)
+            __m256i prev = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(lo, shift_up),
+                                              _mm256_set1_epi32(static_cast<int>(last)), 0x01);
+            unsigned dup = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lo, prev))));
+            if (!has_last) dup &= ~1u;
+            unsigned keep = ~dup & 0xFF;
+            auto kept = static_cast<unsigned>(std::popcount(keep));
+            __m256i packed = _mm256_permutevar8x32_epi32(lo, detail::load_permutation(detail::compress32_table[keep]));
+            detail::store_prefix32(out + count, packed, kept);
+            count += kept;
+            last = static_cast<T>(_mm256_extract_epi32(lo, 7));
+            has_last = true;
+
+            // Refill from the side whose next value is smaller
+            bool take_a = j == b.size() || (i < a.size() && a[i] < b[j]);
+            const T* src = take_a ? a.data() + i : b.data() + j;
+            std::size_t left = take_a ? a.size() - i : b.size() - j;
+            if (left < 8) break;
+            (take_a ? i : j) += 8;
+            detail::merge8<T>(load(src), hi, lo, hi);
+        }
+
+        // Finish: the 8 pending values, the short remainder, then the long one
+        alignas(32) T pending[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(pending), hi);
+        auto unique_pending = static_cast<std::size_t>(std::unique(pending, pending + 8) - pending);
+        std::span<const T> rest_a = a.subspan(i), rest_b = b.subspan(j);
+        auto& shorter = rest_a.size() <= rest_b.size() ? rest_a : rest_b;
+        auto& longer = rest_a.size() <= rest_b.size() ? rest_b : rest_a;
+        T merged[8 + 8];
+        std::size_t m = union_merge(std::span<const T>(pending, unique_pending), shorter, merged);
+        return count + union_merge(std::span<const T>(merged, m), longer, out + count, has_last, last);
+    }
+}
+#endif
+
+// ---- strategy selection ----------------------------------------------------
+
+template<set_word T, bool CountOnly = false>
+std::size_t intersect(std::span<const T> a, std::span<const T> b, T* out = nullptr) {
+    if (a.size() > b.size()) std::swap(a, b);
+    if (a.empty()) return 0;
+    if (a.size() * galloping_ratio < b.size()) return intersect_galloping<T, CountOnly>(a, b, out);
+#if defined(__AVX2__)
+    return intersect_simd<T, CountOnly>(a, b, out);
+#else
+    return intersect_merge<T, CountOnly>(a, b, out);
+#endif
+}
+
+template<set_word T>
+std::size_t intersection_size(std::span<const T> a, std::span<const T> b) {
+    return intersect<T, true>(a, b);
+}
+
+template<set_word T>
+std::size_t union_of(std::span<const T> a, std::span<const T> b, T* out) {
+#if defined(__AVX2__)
+    return union_simd(a, b, out);
+#else
+    return union_merge(a, b, out);
+#endif
+}
+
+// |A u B| = |A| + |B| - |A n B|, so counting reuses the intersection kernels
+template<set_word T>
+std::size_t union_size(std::span<const T> a, std::span<const T> b) {
+    return a.size() + b.size() - intersection_size(a, b);
+}
+
+// ---- std-algorithm-compatible wrappers -------------------------------------
+
+namespace detail {
+
+template<typename I1, typename I2>
+concept kernel_inputs = std::contiguous_iterator<I1> && std::contiguous_iterator<I2> &&
+                        std::same_as<std::iter_value_t<I1>, std::iter_value_t<I2>> &&
+                        set_word<std::iter_value_t<I1>>;
+
+template<typename O, typename T>
+concept contiguous_output = std::contiguous_iterator<O> && std::same_as<std::iter_value_t<O>, T>;
+
+// The kernels need set semantics; sorted multisets (valid for std::set_*)
+// keep the standard algorithm's duplicate handling
+template<typename I>
+bool strictly_increasing(I first, I last) {
+    return std::adjacent_find(first, last) == last;
+}
+
+template<typename I1, typename I2, typename O, typename Kernel>
+O run_kernel(I1 first1, I1 last1, I2 first2, I2 last2, O out, std::size_t bound, Kernel kernel) {
+    using T = std::iter_value_t<I1>;
+    std::span<const T> a(std::to_address(first1), static_cast<std::size_t>(last1 - first1));
+    std::span<const T> b(std::to_address(first2), static_cast<std::size_t>(last2 - first2));
+    if constexpr (contiguous_output<O, T>) {
+        return out + static_cast<std::iter_difference_t<O>>(kernel(a, b, std::to_address(out)));
+    } else {
+        // back_inserter and friends: stage the result, then copy
+        std::vector<T> staged(bound);
+        staged.resize(kernel(a, b, staged.data()));
+        return std::copy(staged.begin(), staged.end(), out);
+    }
+}
+
+} // namespace detail
+
+// Drop-in for std::set_intersection. Contiguous integer ranges without
+// duplicates go to the kernels; other element or iterator types, and sorted
+// ranges with repeats, forward to the standard algorithm. Checking for repeats
+// is a linear scan, so callers that already know their inputs are sets and
+// want galloping's sublinear cost should call intersect() directly.
+template<std::input_iterator I1, std::input_iterator I2, typename O>
+O set_intersection(I1 first1, I1 last1, I2 first2, I2 last2, O out) {
+    if constexpr (detail::kernel_inputs<I1, I2>) {
+        if (!detail::strictly_increasing(first1, last1) || !detail::strictly_increasing(first2, last2))
+            return std::set_intersection(first1, last1, first2, last2, out);
+        using T = std::iter_value_t<I1>;
+        std::size_t bound = static_cast<std::size_t>(std::min(last1 - first1, last2 - first2));
+        return detail::run_kernel(first1, last1, first2, last2, out, bound,
+                                  [](std::span<const T> a, std::span<const T> b, T* o) { return intersect<T>(a, b, o); });
+    } else {
+        return std::set_intersection(first1, last1, first2, last2, out);
+    }
+}
+
+template<std::input_iterator I1, std::input_iterator I2, typename O>
+O set_union(I1 first1, I1 last1, I2 first2, I2 last2, O out) {
+    if constexpr (detail::kernel_inputs<I1, I2>) {
+        if (!detail::strictly_increasing(first1, last1) || !detail::strictly_increasing(first2, last2))
+            return std::set_union(first1, last1, first2, last2, out);
+        using T = std::iter_value_t<I1>;
+        std::size_t bound = static_cast<std::size_t>((last1 - first1) + (last2 - first2));
+        return detail::run_kernel(first1, last1, first2, last2, out, bound,
+                                  [](std::span<const T> a, std::span<const T> b, T* o) { return union_of<T>(a, b, o); });
+    } else {
+        return std::set_union(first1, last1, first2, last2, out);
+    }
+}
+
+template<std::ranges::contiguous_range R1, std::ranges::contiguous_range R2, typename O>
+O set_intersection(const R1& r1, const R2& r2, O out) {
+    return cpp26_set_kernels::set_intersection(std::ranges::begin(r1), std::ranges::end(r1),
+                                               std::ranges::begin(r2), std::ranges::end(r2), out);
+}
+
+template<std::ranges::contiguous_range R1, std::ranges::contiguous_range R2, typename O>
+O set_union(const R1& r1, const R2& r2, O out) {
+    return cpp26_set_kernels::set_union(std::ranges::begin(r1), std::ranges::end(r1),
+                                        std::ranges::begin(r2), std::ranges::end(r2), out);
+}
+
+void demonstrate_set_kernels() {
+    std::cout << "\n=== SORTED-SET KERNELS ===\n";
+
+    // The inputs of demonstrate_set_algorithms, widened to show the SIMD blocks
+    std::vector<int> v1, v2;
+    for (int i = 1; i <= 20; ++i) v1.push_back(i);
+    for (int i = 3; i <= 40; i += 2) v2.push_back(i);
+
+    std::vector<int> result;
+    set_intersection(v1, v2, std::back_inserter(result));
+    std::cout << "set_intersection: ";
+    for (int x : result) std::cout << x << " ";
+    std::cout << "\n";
+
+    result.clear();
+    set_union(v1.begin(), v1.end(), v2.begin(), v2.end(), std::back_inserter(result));
+    std::cout << "set_union: ";
+    for (int x : result) std::cout << x << " ";
+    std::cout << "\n";
+
+    std::cout << std::format("intersection_size = {}, union_size = {}\n",
+                             intersection_size<int>(v1, v2), union_size<int>(v1, v2));
+
+    // Skewed sizes take the galloping path
+    std::vector<std::uint64_t> big(100000), few = {7, 700, 70000, 299997, 10000000};
+    for (std::size_t i = 0; i < big.size(); ++i) big[i] = 3 * i;
+    std::vector<std::uint64_t> hits(few.size());
+    hits.resize(intersect<std::uint64_t>(few, big, hits.data()));
+    std::cout << "5 probes vs 100000 multiples of 3 (galloping): ";
+    for (auto x : hits) std::cout << x << " ";
+    std::cout << "\n";
+
+    // Non-integral types fall back to the standard algorithm
+    std::vector<double> d1 = {0.5, 1.5, 2.5}, d2 = {1.5, 3.5};
+    std::vector<double> dr;
+    set_union(d1, d2, std::back_inserter(dr));
+    std::cout << std::format("double fallback union size: {}\n", dr.size());
+}
+
+// ============================================================================
+// BENCHMARK - std::set_intersection/std::set_union vs kernels
+// ============================================================================
+template<typename T>
+std::vector<T> sorted_unique_sample(std::size_t n, std::uint64_t universe, cpp26_benchmark::SplitMix64& rng) {
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(rng.next() % universe);
+    std::ranges::sort(v);
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+template<typename T>
+void benchmark_kernels(const char* type_name, std::size_t n) {
+    using namespace cpp26_benchmark;
+    SplitMix64 rng(sizeof(T));
+    auto a = sorted_unique_sample<T>(n, n * 4, rng);
+    auto b = sorted_unique_sample<T>(n, n * 4, rng);
+    auto tiny = sorted_unique_sample<T>(n / 1000 + 1, n * 4, rng);
+    std::vector<T> out(a.size() + b.size());
+    std::span<const T> sa(a), sb(b), st(tiny);
+    std::size_t expect = 0, got = 0;
+
+    std::cout << std::format("{}: |A| = {}, |B| = {}:\n", type_name, a.size(), b.size());
+    print_result("std::set_intersection", best_of_ms(5, [&] {
+        expect = static_cast<std::size_t>(std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin());
+    }), a.size() + b.size());
+    print_result("intersect_merge", best_of_ms(5, [&] { got = intersect_merge<T>(sa, sb, out.data()); }), a.size() + b.size());
+#if defined(__AVX2__)
+    print_result("intersect_simd (AVX2)", best_of_ms(5, [&] { got = intersect_simd<T>(sa, sb, out.data()); }), a.size() + b.size());
+#endif
+    print_result("intersection_size", best_of_ms(5, [&] { got = intersection_size<T>(sa, sb); }), a.size() + b.size());
+    if (got != expect) std::cout << "  intersection mismatch!\n";
+
+    print_result("std::set_union", best_of_ms(5, [&] {
+        expect = static_cast<std::size_t>(std::set_union(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin());
+    }), a.size() + b.size());
+    print_result("union_of", best_of_ms(5, [&] { got = union_of<T>(sa, sb, out.data()); }), a.size() + b.size());
+    if (got != expect) std::cout << "  union mismatch!\n";
+
+    std::cout << std::format("  skewed: |small| = {} vs |B| = {}\n", tiny.size(), b.size());
+    print_result("std::set_intersection", best_of_ms(5, [&] {
+        expect = static_cast<std::size_t>(std::set_intersection(tiny.begin(), tiny.end(), b.begin(), b.end(), out.begin()) - out.begin());
+    }), tiny.size());
+    print_result("intersect (galloping)", best_of_ms(5, [&] { got = intersect<T>(st, sb, out.data()); }), tiny.size());
+    if (got != expect) std::cout << "  skewed mismatch!\n";
+}
+
+void demonstrate_set_kernels_benchmark() {
+    std::cout << "\n=== SORTED-SET KERNELS BENCHMARK ===\n";
+    const std::size_t n = cpp26_benchmark::scaled(1'000'000);
+    benchmark_kernels<std::uint32_t>("uint32", n);
+    benchmark_kernels<std::int64_t>("int64", n);
+}
+
+void run_all_demos() {
+    demonstrate_set_kernels();
+    demonstrate_set_kernels_benchmark();
+}
+
+} // namespace cpp26_set_kernels
@@ -0,0 +1,503 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <optional>
+#include <new>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_skiplist {
+
+// ============================================================================
+// EPOCH-BASED RECLAMATION - Deferred delete for lock-free structures
+// A thread "pins" the current global epoch while it reads shared nodes.
+// Unlinked nodes are retired into a per-thread limbo list tagged with the
+// epoch; once the global epoch has moved two steps past that tag, no pinned
+// thread can still hold a pointer to them and they are freed. The epoch only
+// advances when every pinned thread has observed the current one.
+// Reference: https://en.cppreference.com/w/cpp/atomic/atomic_thread_fence
+// ============================================================================
+class epoch_domain {
+private:
+    static constexpr std::size_t max_threads = 256;
+    static constexpr std::size_t advance_interval = 64;  // Retirements between advance attempts
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    struct alignas(64) Record {
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<bool> active{false};
+        std::atomic<bool> in_use{false};
+        unsigned depth = 0;
+        std::size_t since_advance = 0;
+        std::array<std::vector<Retired>, 3> limbo;
+        std::array<std::uint64_t, 3> limbo_epoch{};
+    };
+
+    // Claims a record for the calling thread and hands leftovers to the orphan list on exit
+    struct ThreadHandle {
+        epoch_domain& domain;
+        Record* record = nullptr;
+
+        explicit ThreadHandle(epoch_domain& d) : domain(d) {
+            for (auto& r : domain.records) {
+                bool expected = false;
+                if (r.in_use.compare_exchange_strong(expected, true)) {
+                    record = &r;
+                    return;
+                }
+            }
+            throw std::runtime_error("epoch_domain: too many threads");
+        }
+
+        ~ThreadHandle() {
+            std::lock_guard lock(domain.orphan_mutex);
+            for (std::size_t b = 0; b < 3; ++b) {
+                for (const auto& item : record->limbo[b]) domain.orphans.emplace_back(record->limbo_epoch[b], item);
+                record->limbo[b].clear();
+            }
+            record->in_use.store(false);
+        }
+    };
+
+    std::atomic<std::uint64_t> global_epoch{0};
+    std::array<Record, max_threads> records;
+    std::mutex orphan_mutex;
+    std::vector<std::pair<std::uint64_t, Retired>> orphans;
+
+    epoch_domain() = default;
+
+    Record& local() {
+        thread_local ThreadHandle handle(*this);
+        return *handle.record;
+    }
+
+    static void free_all(std::vector<Retired>& items) {
+        for (const auto& item : items) item.deleter(item.ptr);
+        items.clear();
+    }
+
+    void collect(Record& r, std::uint64_t epoch) {
+        for (std::size_t b = 0; b < 3; ++b)
+            if (!r.limbo[b].empty() && r.limbo_epoch[b] + 2 <= epoch) free_all(r.limbo[b]);
+    }
+
+    void try_advance() {
+        std::uint64_t epoch = global_epoch.load();
+        for (const auto& r : records)
+            if (r.in_use.load() && r.active.load() && r.epoch.load() != epoch) return;
+        global_epoch.compare_exchange_strong(epoch, epoch + 1);
+
+        std::unique_lock lock(orphan_mutex, std::try_to_lock);
+        if (!lock.owns_lock() || orphans.empty()) return;
+        std::erase_if(orphans, [&](const auto& entry) {
+            if (entry.first + 2 > epoch) return false;
+            entry.second.deleter(entry.second.ptr);
+            return true;
+        });
+    }
+
+public:
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    ~epoch_domain() {
+        for (auto& r : records)
+            for (auto& bucket : r.limbo) free_all(bucket);
+        for (const auto& entry : orphans) entry.second.deleter(entry.second.ptr);
+    }
+
+    static epoch_domain& instance() {
+        static epoch_domain domain;
+        return domain;
+    }
+
+    // RAII pin; nested guards on one thread are cheap
+    class guard {
+    private:
+        epoch_domain& domain;
+        Record& record;
+
+    public:
+        explicit guard(epoch_domain& d = instance()) : domain(d), record(d.local()) {
+            if (record.depth++ > 0) return;
+            std::uint64_t epoch = domain.global_epoch.load();
+            record.epoch.store(epoch);
+            record.active.store(true);
+            // Re-read so an advance that raced with the pin is observed
+            while (true) {
+                std::uint64_t now = domain.global_epoch.load();
+                if (now == epoch) break;
+                epoch = now;
+                record.epoch.store(epoch);
+            }
+            domain.collect(record, epoch);
+        }
+
+        ~guard() {
+            if (--record.depth == 0) record.active.store(false);
+        }
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+    };
+
+    // Defers deleter(ptr) until no pinned thread can observe ptr; call while pinned
+    void retire(void* ptr, void (*deleter)(void*)) {
+        Record& r = local();
+        std::uint64_t epoch = global_epoch.load();
+        std::size_t b = epoch % 3;
+        if (r.limbo_epoch[b] != epoch) {
+            free_all(r.limbo[b]);  // Tagged at least three epochs ago
+            r.limbo_epoch[b] = epoch;
+        }
+        r.limbo[b].push_back({ptr, deleter});
+        if (++r.since_advance >= advance_interval) {
+            r.since_advance = 0;
+            try_advance();
+        }
+    }
+
+    std::uint64_t epoch() const { return global_epoch.load(); }
+};
+
+// ============================================================================
+// CONCURRENT SKIP MAP - Lock-free ordered map (Herlihy & Shavit skip list)
+// Each node's next pointers carry a "deleted" mark in bit 0. erase() marks
+// the tower top-down; the mark on level 0 is the linearization point. Any
+// traversal that meets a marked node CASes it out. find() and range scans
+// never write, so they are wait-free; insert/erase are lock-free.
+// Values are immutable once inserted; iteration is weakly consistent (it
+// sees every key present for the whole scan, and maybe concurrent changes).
+// ============================================================================
+template<typename Key, typename T, int MaxLevel = 20>
+class concurrent_skip_map {
+private:
+    using link = std::atomic<std::uintptr_t>;
+
+    // Tower links are allocated inline after the node, sized to its height
+    struct alignas(link) Node {
+        Key key;
+        T value;
+        std::atomic<int> pending{2};  // Inserter and eraser each release once; the last one retires
+        int height;
+
+        Node(const Key& k, const T& v, int h) : key(k), value(v), height(h) {}
+        link* next() { return std::launder(reinterpret_cast<link*>(this + 1)); }
+    };
+
+    link head[MaxLevel];
+    std::atomic<std::size_t> count{0};
+
+    static Node* ptr(std::uintptr_t v) { return reinterpret_cast<Node*>(v & ~std::uintptr_t{1}); }
+    static bool marked(std::uintptr_t v) { return v & 1; }
+    static std::uintptr_t raw(Node* n) { return reinterpret_cast<std::uintptr_t>(n); }
+
+    static Node* create(const Key& key, const T& value, int height) {
+        void* mem = ::operator new(sizeof(Node) + sizeof(link) * static_cast<std::size_t>(height));
+        Node* node = ::new (mem) Node(key, value, height);
+        for (int i = 0; i < height; ++i) ::new (static_cast<void*>(reinterpret_cast<link*>(node + 1) + i)) link(0);
+        return node;
+    }
+
+    static void destroy(void* p) {
+        Node* node = static_cast<Node*>(p);
+        node->~Node();  // link is trivially destructible
+        ::operator delete(p);
+    }
+
+    // Geometric heights with p = 1/4
+    static int random_level() {
+        thread_local std::uint64_t state = 0x9E3779B97F4A7C15ull ^ std::hash<std::thread::id>{}(std::this_thread::get_id());
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return std::min(1 + std::countr_zero(state | (1ull << 62)) / 2, MaxLevel);
+    }
+
+    static void release(Node* node) {
+        if (node->pending.fetch_sub(1) == 1) epoch_domain::instance().retire(node, &destroy);
+    }
+
+    // Fills preds/succs for key and snips every marked node on the way.
+    // preds[l] is the link array whose slot l precedes the position.
+    Node* find_position(const Key& key, link** preds, Node** succs) {
+    retry:
+        link* pred = head;
+        for (int level = MaxLevel - 1; level >= 0; --level) {
+            std::uintptr_t curr_raw = pred[level].load(std::memory_order_acquire);
+            if (marked(curr_raw)) goto retry;  // pred itself was deleted under us
+            Node* curr = ptr(curr_raw);
+            while (curr) {
+                std::uintptr_t succ_raw = curr->next()[level].load(std::memory_order_acquire);
+                if (marked(succ_raw)) {
+                    std::uintptr_t expected = raw(curr);
+                    if (!pred[level].compare_exchange_strong(expected, succ_raw & ~std::uintptr_t{1}))
+                        goto retry;
+                    curr = ptr(succ_raw);
+                    continue;
+                }
+                if (!(curr->key < key)) break;
+                pred = curr->next();
+                curr = ptr(succ_raw);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return (succs[0] && !(key < succs[0]->key)) ? succs[0] : nullptr;
+    }
+
+    // Read-only descent: first node at level 0 whose key is >= key
+    Node* seek(const Key& key) const {
+        const link* pred = head;
+        Node* curr = nullptr;
+        for (int level = MaxLevel - 1; level >= 0; --level) {
+            curr = ptr(pred[level].load(std::memory_order_acquire));
+            while (curr) {
+                std::uintptr_t succ_raw = curr->next()[level].load(std::memory_order_acquire);
+                if (!marked(succ_raw) && !(curr->key < key)) break;
+                if (!marked(succ_raw)) pred = curr->next();
+                curr = ptr(succ_raw);
+            }
+        }
+        return curr;
+    }
+
+public:
+    concurrent_skip_map() {
+        for (auto& h : head) h.store(0, std::memory_order_relaxed);
+    }
+
+    concurrent_skip_map(const concurrent_skip_map&) = delete;
+    concurrent_skip_map& operator=(const concurrent_skip_map&) = delete;
+
+    // Not thread-safe: every other thread must be done with the map
+    ~concurrent_skip_map() {
+        Node* node = ptr(head[0].load());
+        while (node) {
+            Node* next = ptr(node->next()[0].load());
+            destroy(node);
+            node = next;
+        }
+    }
+
+    std::size_t size() const { return count.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    std::optional<T> find(const Key& key) const {
+        epoch_domain::guard pin;
+        Node* node = seek(key);
+        if (node && !(key < node->key) && !marked(node->next()[0].load(std::memory_order_acquire)))
+            return node->value;
+        return std::nullopt;
+    }
+
+    bool contains(const Key& key) const { return find(key).has_value(); }
+
+    // Inserts if absent; returns false when the key is already present
+    bool insert(const Key& key, const T& value) {
+        epoch_domain::guard pin;
+        link* preds[MaxLevel];
+        Node* succs[MaxLevel];
+        const int height = random_level();
+        Node* node = nullptr;
+
+        while (true) {
+            if (find_position(key, preds, succs)) {
+                if (node) destroy(node);  // Never published
+                return false;
+            }
+            if (!node) node = create(key, value, height);
+            for (int l = 0; l < height; ++l) node->next()[l].store(raw(succs[l]), std::memory_order_relaxed);
+            std::uintptr_t expected = raw(succs[0]);
+            if (preds[0][0].compare_exchange_strong(expected, raw(node), std::memory_order_acq_rel)) break;
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+
+        // Link the upper levels; stop early if an eraser has started marking the tower
+        for (int l = 1; l < height; ++l) {
+            while (true) {
+                std::uintptr_t current = node->next()[l].load(std::memory_order_acquire);
+                if (marked(current)) goto linked;
+                if (ptr(current) != succs[l] &&
+                    !node->next()[l].compare_exchange_strong(current, raw(succs[l])))
+                    goto linked;
+                std::uintptr_t expected = raw(succs[l]);
+                if (preds[l][l].compare_exchange_strong(expected, raw(node), std::memory_order_acq_rel)) break;
+                if (find_position(key, preds, succs) != node) goto linked;
+            }
+        }
+    linked:
+        // An eraser may have finished before we linked the upper levels; unlink again
+        if (marked(node->next()[0].load())) find_position(key, preds, succs);
+        release(node);
+        return true;
+    }
+
+    bool erase(const Key& key) {
+        epoch_domain::guard pin;
+        link* preds[MaxLevel];
+        Node* succs[MaxLevel];
+        Node* victim = find_position(key, preds, succs);
+        if (!victim) return false;
+
+        for (int l = victim->height - 1; l >= 1; --l) {
+            std::uintptr_t v = victim->next()[l].load();
+            while (!marked(v) && !victim->next()[l].compare_exchange_weak(v, v | 1)) {}
+        }
+        std::uintptr_t v = victim->next()[0].load();
+        while (true) {
+            if (marked(v)) return false;  // Another eraser won
+            if (victim->next()[0].compare_exchange_strong(v, v | 1)) break;
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+
+        find_position(key, preds, succs);  // Physically unlink at every level
+        release(victim);
+        return true;
+    }
+
+    // Weakly consistent scan of [lo, hi] along level 0
+    template<typename F>
+    void for_each_in_range(const Key& lo, const Key& hi, F f) const {
+        epoch_domain::guard pin;
+        for (Node* node = seek(lo); node && !(hi < node->key);) {
+            std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+            if (!marked(next)) f(node->key, node->value);
+            node = ptr(next);
+        }
+    }
+
+    template<typename F>
+    void for_each(F f) const {
+        epoch_domain::guard pin;
+        for (Node* node = ptr(head[0].load(std::memory_order_acquire)); node;) {
+            std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+            if (!marked(next)) f(node->key, node->value);
+            node = ptr(next);
+        }
+    }
+};
+
+void demonstrate_concurrent_skip_map() {
+    std::cout << "\n=== LOCK-FREE SKIP LIST MAP ===\n";
+
+    concurrent_skip_map<int, int> map;
+
+    // Four writers insert interleaved key ranges while erasing every third key
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&map, t] {
+            for (int i = t; i < 4000; i += 4) map.insert(i, i * i);
+            for (int i = t; i < 4000; i += 4)
+                if (i % 3 == 0) map.erase(i);
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    std::size_t visited = 0;
+    int previous = -1;
+    bool ordered = true;
+    map.for_each([&](int k, int) {
+        ordered = ordered && k > previous;
+        previous = k;
+        ++visited;
+    });
+    std::cout << std::format("After 4 threads: size={}, scan visited {}, keys ordered: {}\n",
+                             map.size(), visited, ordered);
+    std::cout << std::format("find(10)={}, find(9) present? {}, insert(10) again? {}\n",
+                             map.find(10).value_or(-1), map.contains(9), map.insert(10, 0));
+
+    std::cout << "Range [20, 40]: ";
+    map.for_each_in_range(20, 40, [](int k, int v) { std::cout << k << "=" << v << " "; });
+    std::cout << "\n";
+    std::cout << std::format("Reclamation epoch now {}\n", epoch_domain::instance().epoch());
+}
+
+// ============================================================================
+// SCALING BENCHMARK - skip list vs std::map + std::shared_mutex
+// 90% find, 5% insert, 5% erase over a half-full key space
+// ============================================================================
+void demonstrate_skiplist_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== CONCURRENT SKIP LIST BENCHMARK ===\n";
+
+    const std::uint64_t key_space = 1 << 18;
+    const std::size_t ops_per_thread = scaled(200'000);
+
+    struct LockedMap {
+        std::map<std::uint64_t, std::uint64_t> map;
+        mutable std::shared_mutex mutex;
+
+        bool find(std::uint64_t k) const {
+            std::shared_lock lock(mutex);
+            return map.find(k) != map.end();
+        }
+        void insert(std::uint64_t k, std::uint64_t v) {
+            std::unique_lock lock(mutex);
+            map.emplace(k, v);
+        }
+        void erase(std::uint64_t k) {
+            std::unique_lock lock(mutex);
+            map.erase(k);
+        }
+    };
+
+    auto run = [&](auto& target, int threads) {
+        return time_ms([&] {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&target, t, ops_per_thread, key_space] {
+                    SplitMix64 rng(static_cast<std::uint64_t>(t) + 1);
+                    std::size_t hits = 0;
+                    for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                        std::uint64_t r = rng.next();
+                        std::uint64_t key = r % key_space;
+                        unsigned op = static_cast<unsigned>(r >> 57) % 20;
+                        if (op == 0) target.insert(key, r);
+                        else if (op == 1) target.erase(key);
+                        else hits += static_cast<bool>(target.find(key));
+                    }
+                    do_not_optimize(hits);
+                });
+            }
+            for (auto& w : workers) w.join();
+        });
+    };
+
+    std::cout << std::format("hardware threads: {}\n", std::thread::hardware_concurrency());
+    for (int threads : {1, 2, 4, 8}) {
+        concurrent_skip_map<std::uint64_t, std::uint64_t> skip;
+        LockedMap locked;
+        for (std::uint64_t k = 0; k < key_space; k += 2) {
+            skip.insert(k, k);
+            locked.map.emplace(k, k);
+        }
+        const std::size_t total = ops_per_thread * static_cast<std::size_t>(threads);
+        print_result(std::format("std::map + shared_mutex, {} thr", threads), run(locked, threads), total);
+        print_result(std::format("concurrent_skip_map, {} thr", threads), run(skip, threads), total);
+    }
+}
+
+void run_all_demos() {
+    demonstrate_concurrent_skip_map();
+    demonstrate_skiplist_benchmark();
+}
+
+} // namespace cpp26_skiplist
@@ -0,0 +1,394 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <span>
+#include <string>
+#include <algorithm>
+#include <numeric>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_soa {
+
+// ============================================================================
+// ALIGNED ALLOCATOR - Cache-line aligned storage for SIMD-friendly columns
+// Reference: https://en.cppreference.com/w/cpp/memory/new/align_val_t
+// ============================================================================
+template<typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+template<typename T>
+using column_vector = std::vector<T, AlignedAllocator<T>>;
+
+template<typename... Fields>
+class soa_vector;
+
+// ============================================================================
+// SOA ROW - Proxy that presents one index across all columns as a "row"
+// Supports get<I>() and structured bindings, which bind to column elements
+// ============================================================================
+template<bool Const, typename... Fields>
+class soa_row {
+private:
+    using owner_type = std::conditional_t<Const, const soa_vector<Fields...>, soa_vector<Fields...>>;
+
+    owner_type* owner;
+    std::size_t row;
+
+public:
+    soa_row(owner_type* o, std::size_t i) : owner(o), row(i) {}
+
+    template<std::size_t I>
+    decltype(auto) get() const {
+        return owner->template column<I>()[row];
+    }
+
+    std::size_t index() const { return row; }
+
+    // Copies the row out as a value tuple
+    std::tuple<Fields...> to_tuple() const {
+        return [this]<std::size_t... I>(std::index_sequence<I...>) {
+            return std::tuple<Fields...>(get<I>()...);
+        }(std::index_sequence_for<Fields...>{});
+    }
+};
+
+// ============================================================================
+// SOA_VECTOR - Structure-of-arrays container
+// Each field lives in its own contiguous, 64-byte aligned column, so a scan
+// or filter over one field streams only that field through the cache and
+// the compiler can vectorize the loop.
+// ============================================================================
+template<typename... Fields>
+class soa_vector {
+private:
+    std::tuple<column_vector<Fields>...> columns;
+
+    template<typename Func>
+    void for_each_column(Func&& func) {
+        std::apply([&](auto&... col) { (func(col), ...); }, columns);
+    }
+
+public:
+    using row_reference = soa_row<false, Fields...>;
+    using const_row_reference = soa_row<true, Fields...>;
+
+    static constexpr std::size_t field_count = sizeof...(Fields);
+
+    template<std::size_t I>
+    using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    // Random-access iterator over rows (dereferences to a proxy, like vector<bool>)
+    template<bool Const>
+    class basic_iterator {
+    private:
+        using owner_type = std::conditional_t<Const, const soa_vector, soa_vector>;
+        owner_type* owner = nullptr;
+        std::size_t row = 0;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Fields...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = soa_row<Const, Fields...>;
+
+        basic_iterator() = default;
+        basic_iterator(owner_type* o, std::size_t i) : owner(o), row(i) {}
+
+        reference operator*() const { return reference(owner, row); }
+        reference operator[](difference_type n) const { return reference(owner, row + n); }
+
+        basic_iterator& operator++() { ++row; return *this; }
+        basic_iterator operator++(int) { auto tmp = *this; ++row; return tmp; }
+        basic_iterator& operator--() { --row; return *this; }
+        basic_iterator operator--(int) { auto tmp = *this; --row; return tmp; }
+        basic_iterator& operator+=(difference_type n) { row += n; return *this; }
+        basic_iterator& operator-=(difference_type n) { row -= n; return *this; }
+        basic_iterator operator+(difference_type n) const { return basic_iterator(owner, row + n); }
+        basic_iterator operator-(difference_type n) const { return basic_iterator(owner, row - n); }
+        difference_type operator-(const basic_iterator& other) const {
+            return static_cast<difference_type>(row) - static_cast<difference_type>(other.row);
+        }
+
+        bool operator==(const basic_iterator& other) const { return row == other.row; }
+        auto operator<=>(const basic_iterator& other) const { return row <=> other.row; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    soa_vector() = default;
+
+    // Capacity
+    std::size_t size() const { return std::get<0>(columns).size(); }
+    bool empty() const { return size() == 0; }
+
+    void reserve(std::size_t n) {
+        for_each_column([n](auto& col) { col.reserve(n); });
+    }
+
+    void clear() {
+        for_each_column([](auto& col) { col.clear(); });
+    }
+
+    // Modifiers
+    void push_back(const Fields&... values) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (std::get<I>(columns).push_back(values), ...);
+        }(std::index_sequence_for<Fields...>{});
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "one argument per field");
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (std::get<I>(columns).emplace_back(std::forward<Args>(args)), ...);
+        }(std::index_sequence_for<Fields...>{});
+    }
+
+    void pop_back() {
+        for_each_column([](auto& col) { col.pop_back(); });
+    }
+
+    // O(1) erase that moves the last row into the hole (row order not preserved)
+    void swap_remove(std::size_t i) {
+        for_each_column([i](auto& col) {
+            col[i] = std::move(col.back());
+            col.pop_back();
+        });
+    }
+
+    // Column access - contiguous, aligned spans suitable for SIMD loops
+    template<std::size_t I>
+    std::span<field_type<I>> column() { return std::get<I>(columns); }
+
+    template<std::size_t I>
+    std::span<const field_type<I>> column() const { return std::get<I>(columns); }
+
+    // Row access
+    row_reference operator[](std::size_t i) { return row_reference(this, i); }
+    const_row_reference operator[](std::size_t i) const { return const_row_reference(this, i); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    // Indices of rows whose field I satisfies pred
+    template<std::size_t I, typename Pred>
+    std::vector<std::uint32_t> select_where(Pred pred) const {
+        auto col = column<I>();
+        std::vector<std::uint32_t> result;
+        for (std::size_t i = 0; i < col.size(); ++i) {
+            if (pred(col[i])) result.push_back(static_cast<std::uint32_t>(i));
+        }
+        return result;
+    }
+
+    // Permutation that orders the rows by field I
+    template<std::size_t I, typename Compare = std::less<>>
+    std::vector<std::uint32_t> sort_permutation(Compare comp = {}) const {
+        auto col = column<I>();
+        std::vector<std::uint32_t> perm(col.size());
+        std::iota(perm.begin(), perm.end(), 0u);
+        std::sort(perm.begin(), perm.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return comp(col[a], col[b]);
+        });
+        return perm;
+    }
+
+    // Reorders every column so that new row i is old row perm[i]
+    void apply_permutation(const std::vector<std::uint32_t>& perm) {
+        for_each_column([&perm](auto& col) {
+            std::remove_reference_t<decltype(col)> gathered;
+            gathered.reserve(col.size());
+            for (std::uint32_t p : perm) gathered.push_back(std::move(col[p]));
+            col.swap(gathered);
+        });
+    }
+
+    // Sorts rows by field I: sort only the key column's indices, then gather once per column
+    template<std::size_t I, typename Compare = std::less<>>
+    void sort_by(Compare comp = {}) {
+        apply_permutation(sort_permutation<I>(comp));
+    }
+};
+
+} // namespace cpp26_soa
+
+// Structured bindings for soa_row: auto [name, age] = people[i];
+template<bool Const, typename... Fields>
+struct std::tuple_size<cpp26_soa::soa_row<Const, Fields...>>
+    : std::integral_constant<std::size_t, sizeof...(Fields)> {};
+
+template<std::size_t I, bool Const, typename... Fields>
+struct std::tuple_element<I, cpp26_soa::soa_row<Const, Fields...>> {
+    using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+    using type = std::conditional_t<Const, const field&, field&>;
+};
+
+namespace cpp26_soa {
+
+void demonstrate_soa_vector() {
+    std::cout << "\n=== SOA_VECTOR (Structure of Arrays) ===\n";
+
+    // Field indices for readability
+    constexpr std::size_t name = 0, age = 1, salary = 2;
+
+    soa_vector<std::string, int, double> people;
+    people.emplace_back("Alice", 30, 85'000.0);
+    people.emplace_back("Bob", 25, 62'000.0);
+    people.emplace_back("Charlie", 35, 120'000.0);
+    people.emplace_back("Diana", 28, 91'000.0);
+
+    std::cout << "Rows: ";
+    for (auto row : people) {
+        std::cout << std::format("{{{}, {}}} ", row.get<name>(), row.get<age>());
+    }
+    std::cout << "\n";
+
+    // Structured bindings bind directly to the column elements
+    auto [n, a, s] = people[1];
+    a += 1;
+    std::cout << std::format("After birthday: {} is {}\n", n, people[1].get<age>());
+
+    // Whole-column access: contiguous and 64-byte aligned
+    auto ages = people.column<age>();
+    std::cout << std::format("Age column: {} ints, aligned to 64: {}\n", ages.size(),
+                             reinterpret_cast<std::uintptr_t>(ages.data()) % 64 == 0);
+    std::cout << std::format("Average age: {:.1f}\n",
+                             std::accumulate(ages.begin(), ages.end(), 0.0) / ages.size());
+
+    // Filter on one column
+    auto high_earners = people.select_where<salary>([](double x) { return x > 80'000.0; });
+    std::cout << "Salary > 80000: ";
+    for (auto i : high_earners) std::cout << people[i].get<name>() << " ";
+    std::cout << "\n";
+
+    // Sort by one field; every column is permuted to match
+    people.sort_by<age>();
+    std::cout << "Sorted by age: ";
+    for (auto row : people) {
+        std::cout << std::format("{{{}, {}}} ", row.get<name>(), row.get<age>());
+    }
+    std::cout << "\n";
+
+    people.swap_remove(0);
+    std::cout << std::format("After swap_remove(0): size={}, first={}\n",
+                             people.size(), people[0].get<name>());
+}
+
+// ============================================================================
+// SOA vs AOS BENCHMARK - Scans, filters and sorts on one field
+// ============================================================================
+void demonstrate_soa_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== SOA vs AOS BENCHMARK ===\n";
+
+    struct Person {
+        std::string name;
+        int age;
+        double salary;
+        std::uint64_t id;
+    };
+
+    constexpr std::size_t age = 1;
+    const std::size_t n = scaled(200'000);
+
+    SplitMix64 rng;
+    std::vector<Person> aos;
+    soa_vector<std::string, int, double, std::uint64_t> soa;
+    aos.reserve(n);
+    soa.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        int a = static_cast<int>(18 + rng.next() % 60);
+        double s = 30'000.0 + static_cast<double>(rng.next() % 150'000);
+        std::string name = std::format("person_{}", i);
+        aos.push_back({name, a, s, i});
+        soa.emplace_back(std::move(name), a, s, i);
+    }
+
+    std::cout << std::format("{} records, sizeof(Person)={} bytes, age column stride=4 bytes\n",
+                             n, sizeof(Person));
+
+    // Scan: sum one field
+    double t_aos_scan = best_of_ms(5, [&] {
+        long long sum = 0;
+        for (const auto& p : aos) sum += p.age;
+        do_not_optimize(sum);
+    });
+    double t_soa_scan = best_of_ms(5, [&] {
+        long long sum = 0;
+        for (int a : soa.column<age>()) sum += a;
+        do_not_optimize(sum);
+    });
+    print_result("scan sum(age)   vector<Person>", t_aos_scan, n);
+    print_result("scan sum(age)   soa_vector", t_soa_scan, n);
+
+    // Filter: count rows matching a predicate
+    double t_aos_filter = best_of_ms(5, [&] {
+        std::size_t count = 0;
+        for (const auto& p : aos) count += (p.age > 40);
+        do_not_optimize(count);
+    });
+    double t_soa_filter = best_of_ms(5, [&] {
+        std::size_t count = 0;
+        for (int a : soa.column<age>()) count += (a > 40);
+        do_not_optimize(count);
+    });
+    print_result("filter age>40   vector<Person>", t_aos_filter, n);
+    print_result("filter age>40   soa_vector", t_soa_filter, n);
+
+    // Sort by one field (on copies so each run starts unsorted)
+    double t_aos_sort = time_ms([&] {
+        auto copy = aos;
+        std::sort(copy.begin(), copy.end(),
+                  [](const Person& a, const Person& b) { return a.age < b.age; });
+        do_not_optimize(copy.front().age);
+    });
+    double t_soa_sort = time_ms([&] {
+        auto copy = soa;
+        copy.sort_by<age>();
+        do_not_optimize(copy.column<age>()[0]);
+    });
+    print_result("sort by age     vector<Person>", t_aos_sort, n);
+    print_result("sort by age     soa_vector", t_soa_sort, n);
+}
+
+void run_all_demos() {
+    demonstrate_soa_vector();
+    demonstrate_soa_benchmark();
+}
+
+} // namespace cpp26_soa
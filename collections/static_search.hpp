@@ -0,0 +1,404 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <limits>
+#include <bit>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_static_search {
+
+// Keys and ranks of both indexes start on a cache-line boundary so that the
+// prefetch/block arithmetic below lines up with real cache lines
+template<typename T>
+struct cache_aligned_allocator {
+    using value_type = T;
+
+    cache_aligned_allocator() = default;
+    template<typename U>
+    cache_aligned_allocator(const cache_aligned_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{64})); }
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t{64}); }
+
+    template<typename U>
+    bool operator==(const cache_aligned_allocator<U>&) const noexcept { return true; }
+};
+
+template<typename T>
+using aligned_vector = std::vector<T, cache_aligned_allocator<T>>;
+
+inline void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+inline std::uint32_t checked_rank(std::size_t n) {
+    if (n >= std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("static search index holds at most 2^32 - 2 keys");
+    return static_cast<std::uint32_t>(n);
+}
+
+// ============================================================================
+// EYTZINGER LAYOUT - Sorted keys stored in BFS order of an implicit tree
+// Node k has children 2k and 2k+1, so the first levels of every search share
+// the same few cache lines, and the 16 great-great-grandchildren of node k
+// (4-byte keys) sit in one cache line that can be prefetched four levels
+// ahead. The descent is branchless; the answer is recovered at the end by
+// stripping the trailing "went right" bits from k.
+// Results are ranks into the original sorted sequence, as with
+// std::lower_bound(first, last, x) - first.
+// ============================================================================
+template<typename T>
+class eytzinger_index {
+private:
+    aligned_vector<T> keys;             // keys[1..n] in BFS order, keys[0] unused
+    aligned_vector<std::uint32_t> ranks;  // ranks[k] = sorted position of keys[k]; ranks[0] = n
+    std::size_t n = 0;
+    int full_levels = 0;  // Levels every search passes through before k can exceed n
+
+    // Keys per cache line, i.e. how far ahead (in tree levels) one prefetch looks
+    static constexpr std::size_t lookahead = std::max<std::size_t>(1, 64 / sizeof(T));
+
+    // In-order walk of the implicit tree hands out the sorted keys
+    void fill(std::span<const T> sorted, std::size_t& next, std::size_t k) {
+        if (k > n) return;
+        fill(sorted, next, 2 * k);
+        ranks[k] = static_cast<std::uint32_t>(next);
+        keys[k] = sorted[next++];
+        fill(sorted, next, 2 * k + 1);
+    }
+
+    // Eytzinger index of the answer (0 = past the end) from the final k
+    static std::size_t resolve(std::size_t k) { return k >> (std::countr_one(k) + 1); }
+
+    template<bool Strict>
+    static bool go_right(const T& key, const T& x) {
+        if constexpr (Strict) return key <= x;  // upper_bound: first key > x
+        else return key < x;                    // lower_bound: first key >= x
+    }
+
+    template<bool Strict>
+    std::size_t descend(const T& x) const {
+        std::size_t k = 1;
+        while (k <= n) {
+            prefetch(keys.data() + k * lookahead);
+            k = 2 * k + go_right<Strict>(keys[k], x);
+        }
+        return ranks[resolve(k)];
+    }
+
+    template<bool Strict, std::size_t Group>
+    void descend_batch(std::span<const T> queries, std::span<std::size_t> out) const {
+        if (out.size() < queries.size()) throw std::invalid_argument("output span is smaller than queries");
+        std::size_t q = 0;
+        // Groups of independent searches in lockstep keep several misses in flight
+        for (; q + Group <= queries.size(); q += Group) {
+            std::size_t k[Group];
+            for (std::size_t g = 0; g < Group; ++g) k[g] = 1;
+            for (int level = 0; level < full_levels; ++level) {
+                for (std::size_t g = 0; g < Group; ++g) {
+                    prefetch(keys.data() + k[g] * lookahead);
+                    k[g] = 2 * k[g] + go_right<Strict>(keys[k[g]], queries[q + g]);
+                }
+            }
+            for (std::size_t g = 0; g < Group; ++g) {
+                // Partial last level: only descend from nodes that exist
+                std::size_t kk = k[g];
+                if (kk <= n) kk = 2 * kk + go_right<Strict>(keys[kk], queries[q + g]);
+                out[q + g] = ranks[resolve(kk)];
+            }
+        }
+        for (; q < queries.size(); ++q) out[q] = descend<Strict>(queries[q]);
+    }
+
+public:
+    eytzinger_index() = default;
+
+    // sorted must be in non-decreasing order
+    explicit eytzinger_index(std::span<const T> sorted) : n(sorted.size()) {
+        checked_rank(n);
+        if (!std::ranges::is_sorted(sorted)) throw std::invalid_argument("eytzinger_index requires sorted input");
+        keys.resize(n + 1);
+        ranks.resize(n + 1);
+        ranks[0] = static_cast<std::uint32_t>(n);
+        std::size_t next = 0;
+        fill(sorted, next, 1);
+        full_levels = n ? std::bit_width(n) - 1 : 0;
+    }
+
+    std::size_t size() const { return n; }
+
+    std::size_t lower_bound(const T& x) const { return descend<false>(x); }
+    std::size_t upper_bound(const T& x) const { return descend<true>(x); }
+    std::pair<std::size_t, std::size_t> equal_range(const T& x) const { return {lower_bound(x), upper_bound(x)}; }
+    bool contains(const T& x) const {
+        std::size_t r = lower_bound(x);
+        return r < n && !(x < (*this)[r]);
+    }
+
+    // Key of sorted rank r; the ranks form a BST in the same layout
+    const T& operator[](std::size_t r) const {
+        std::size_t k = 1;
+        while (ranks[k] != r) k = 2 * k + (ranks[k] < r);
+        return keys[k];
+    }
+
+    template<std::size_t Group = 16>
+    void lower_bound_batch(std::span<const T> queries, std::span<std::size_t> out) const {
+        descend_batch<false, Group>(queries, out);
+    }
+
+    template<std::size_t Group = 16>
+    void upper_bound_batch(std::span<const T> queries, std::span<std::size_t> out) const {
+        descend_batch<true, Group>(queries, out);
+    }
+};
+
+// ============================================================================
+// STATIC B-TREE LAYOUT (S-tree) - Implicit B-tree with one cache line per node
+// Each node holds B sorted keys (16 x 4 bytes = one cache line) and has B + 1
+// implicit children at k * (B + 1) + i + 1, so a search touches
+// log_{B+1}(n) lines instead of log2(n). Within a node the slot is the count
+// of keys < x, computed with an AVX2 compare + popcount for 32-bit integers
+// and a vectorizable loop otherwise. Unused slots are padded with the type's
+// max value and rank n, so they never change the answer.
+// ============================================================================
+template<typename T, std::size_t B = 64 / sizeof(T)>
+class btree_index {
+private:
+    static_assert(std::is_arithmetic_v<T>, "btree_index pads with numeric_limits<T>::max()");
+
+    aligned_vector<T> keys;               // nodes * B keys
+    aligned_vector<std::uint32_t> ranks;  // sorted rank of each slot
+    std::size_t n = 0;
+    std::size_t nodes = 0;
+
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    static std::size_t child(std::size_t k, std::size_t i) { return k * (B + 1) + i + 1; }
+
+    // Ranks are read once per search rather than once per level, saving a miss per node
+    std::size_t rank_of(std::size_t slot) const { return slot == none ? n : ranks[slot]; }
+
+    // In-order fill of node k and its subtrees
+    void fill(std::span<const T> sorted, std::size_t& next, std::size_t k) {
+        if (k >= nodes) return;
+        for (std::size_t i = 0; i < B; ++i) {
+            fill(sorted, next, child(k, i));
+            if (next < sorted.size()) {
+                keys[k * B + i] = sorted[next];
+                ranks[k * B + i] = static_cast<std::uint32_t>(next++);
+            }
+        }
+        fill(sorted, next, child(k, B));
+    }
+
+    // Number of keys in node k that go before x (< x, or <= x when Strict)
+    template<bool Strict>
+    std::size_t rank_in_node(std::size_t k, const T& x) const {
+        const T* node = keys.data() + k * B;
+#if defined(__AVX2__)
+        if constexpr (std::is_integral_v<T> && sizeof(T) == 4 && B == 16) {
+            // Flip the sign bit so unsigned keys compare correctly with the signed instruction
+            constexpr std::uint32_t bias = std::is_signed_v<T> ? 0u : 0x80000000u;
+            __m256i flip = _mm256_set1_epi32(static_cast<std::int32_t>(bias));
+            __m256i probe = _mm256_set1_epi32(static_cast<std::int32_t>(static_cast<std::uint32_t>(x) ^ bias));
+            __m256i lo = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node)), flip);
+            __m256i hi = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node + 8)), flip);
+            // lower_bound counts keys < x; upper_bound counts keys <= x, i.e. B minus keys > x
+            __m256i below_lo = Strict ? _mm256_cmpgt_epi32(lo, probe) : _mm256_cmpgt_epi32(probe, lo);
+            __m256i below_hi = Strict ? _mm256_cmpgt_epi32(hi, probe) : _mm256_cmpgt_epi32(probe, hi);
+            auto bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(below_lo))) |
+                        static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(below_hi))) << 8;
+            auto count = static_cast<std::size_t>(std::popcount(bits));
+            return Strict ? B - count : count;
+        }
+#endif
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < B; ++i) {
+            if constexpr (Strict) count += node[i] <= x;
+            else count += node[i] < x;
+        }
+        return count;
+    }
+
+    template<bool Strict>
+    std::size_t descend(const T& x) const {
+        std::size_t slot = none;
+        for (std::size_t k = 0; k < nodes;) {
+            std::size_t i = rank_in_node<Strict>(k, x);
+            if (i < B) slot = k * B + i;
+            k = child(k, i);
+            if (k < nodes) prefetch(keys.data() + k * B);
+        }
+        return rank_of(slot);
+    }
+
+public:
+    btree_index() = default;
+
+    explicit btree_index(std::span<const T> sorted) : n(sorted.size()) {
+        checked_rank(n);
+        if (!std::ranges::is_sorted(sorted)) throw std::invalid_argument("btree_index requires sorted input");
+        nodes = (n + B - 1) / B;
+        keys.assign(nodes * B, std::numeric_limits<T>::max());
+        ranks.assign(nodes * B, static_cast<std::uint32_t>(n));
+        std::size_t next = 0;
+        fill(sorted, next, 0);
+    }
+
+    std::size_t size() const { return n; }
+
+    std::size_t lower_bound(const T& x) const { return descend<false>(x); }
+    std::size_t upper_bound(const T& x) const { return descend<true>(x); }
+    std::pair<std::size_t, std::size_t> equal_range(const T& x) const { return {lower_bound(x), upper_bound(x)}; }
+
+    // Interleaves Group searches level by level so their cache misses overlap
+    template<std::size_t Group = 8>
+    void lower_bound_batch(std::span<const T> queries, std::span<std::size_t> out) const {
+        if (out.size() < queries.size()) throw std::invalid_argument("output span is smaller than queries");
+        std::size_t q = 0;
+        for (; q + Group <= queries.size(); q += Group) {
+            std::size_t k[Group], slot[Group];
+            for (std::size_t g = 0; g < Group; ++g) k[g] = 0, slot[g] = none;
+            bool active = nodes > 0;
+            while (active) {
+                active = false;
+                for (std::size_t g = 0; g < Group; ++g) {
+                    if (k[g] >= nodes) continue;
+                    std::size_t i = rank_in_node<false>(k[g], queries[q + g]);
+                    if (i < B) slot[g] = k[g] * B + i;
+                    k[g] = child(k[g], i);
+                    if (k[g] < nodes) {
+                        prefetch(keys.data() + k[g] * B);
+                        active = true;
+                    }
+                }
+            }
+            for (std::size_t g = 0; g < Group; ++g) out[q + g] = rank_of(slot[g]);
+        }
+        for (; q < queries.size(); ++q) out[q] = lower_bound(queries[q]);
+    }
+};
+
+// Plain branch-free binary search over the sorted array, as a baseline
+template<typename T>
+std::size_t branchless_lower_bound(std::span<const T> sorted, const T& x) {
+    const T* base = sorted.data();
+    std::size_t len = sorted.size();
+    if (len == 0) return 0;
+    while (len > 1) {
+        std::size_t half = len / 2;
+        base = base[half - 1] < x ? base + half : base;
+        len -= half;
+    }
+    return static_cast<std::size_t>(base - sorted.data()) + (*base < x);
+}
+
+void demonstrate_static_search() {
+    std::cout << "\n=== STATIC SEARCH LAYOUTS ===\n";
+
+    std::vector<int> sorted = {1, 3, 3, 5, 8, 13, 21, 21, 21, 34, 55, 89};
+    eytzinger_index<int> eyt(sorted);
+    btree_index<int, 4> tree(sorted);  // Tiny nodes so the example has several levels
+
+    std::cout << "Sorted: ";
+    for (int v : sorted) std::cout << v << " ";
+    std::cout << "\n";
+
+    std::cout << "x    std::lower_bound  eytzinger  btree   equal_range(eytzinger)\n";
+    for (int x : {0, 3, 4, 21, 89, 100}) {
+        auto std_rank = static_cast<std::size_t>(std::ranges::lower_bound(sorted, x) - sorted.begin());
+        auto [lo, hi] = eyt.equal_range(x);
+        std::cout << std::format("{:<4} {:>16}  {:>9}  {:>5}   [{}, {})\n", x, std_rank, eyt.lower_bound(x),
+                                 tree.lower_bound(x), lo, hi);
+    }
+
+    std::vector<int> queries = {2, 13, 50, 90};
+    std::vector<std::size_t> out(queries.size());
+    eyt.lower_bound_batch<2>(queries, out);
+    std::cout << "Batched lower_bound ranks:";
+    for (std::size_t i = 0; i < queries.size(); ++i) std::cout << std::format(" {}->{}", queries[i], out[i]);
+    std::cout << std::format("\neyt[4] = {}, contains(8) = {}, contains(9) = {}\n", eyt[4], eyt.contains(8),
+                             eyt.contains(9));
+}
+
+// ============================================================================
+// BENCHMARK - Random lower_bound over a sorted array larger than the LLC
+// ============================================================================
+void demonstrate_static_search_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== STATIC SEARCH BENCHMARK ===\n";
+
+    const std::size_t n = scaled(1 << 23);
+    const std::size_t q = scaled(1 << 21);
+    SplitMix64 rng(99);
+
+    std::vector<std::uint32_t> sorted(n);
+    for (auto& v : sorted) v = static_cast<std::uint32_t>(rng.next());
+    std::ranges::sort(sorted);
+    std::vector<std::uint32_t> queries(q);
+    for (auto& v : queries) v = static_cast<std::uint32_t>(rng.next());
+    std::span<const std::uint32_t> keys(sorted);
+
+    eytzinger_index<std::uint32_t> eyt;
+    btree_index<std::uint32_t> tree;
+    std::cout << std::format("{} sorted uint32 keys ({} MiB), {} random queries:\n", n, n * 4 >> 20, q);
+    print_result("eytzinger build", time_ms([&] { eyt = eytzinger_index<std::uint32_t>(keys); }), n);
+    print_result("btree_index build", time_ms([&] { tree = btree_index<std::uint32_t>(keys); }), n);
+
+    std::vector<std::size_t> out(q);
+    std::size_t expected = 0;
+    for (auto x : queries) expected += static_cast<std::size_t>(std::ranges::lower_bound(sorted, x) - sorted.begin());
+
+    auto run = [&](const char* label, auto&& search) {
+        std::size_t sum = 0;
+        double ms = best_of_ms(3, [&] {
+            search();
+            sum = 0;
+            for (auto r : out) sum += r;
+        });
+        print_result(label, ms, q);
+        if (sum != expected) std::cout << "  checksum mismatch!\n";
+    };
+
+    run("std::lower_bound", [&] {
+        for (std::size_t i = 0; i < q; ++i)
+            out[i] = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), queries[i]) - sorted.begin());
+    });
+    run("branchless binary search", [&] {
+        for (std::size_t i = 0; i < q; ++i) out[i] = branchless_lower_bound(keys, queries[i]);
+    });
+    run("eytzinger + prefetch", [&] {
+        for (std::size_t i = 0; i < q; ++i) out[i] = eyt.lower_bound(queries[i]);
+    });
+    run("eytzinger batched (16)", [&] { eyt.lower_bound_batch(queries, out); });
+    run("btree_index", [&] {
+        for (std::size_t i = 0; i < q; ++i) out[i] = tree.lower_bound(queries[i]);
+    });
+    run("btree_index batched (8)", [&] { tree.lower_bound_batch(queries, out); });
+}
+
+void run_all_demos() {
+    demonstrate_static_search();
+    demonstrate_static_search_benchmark();
+}
+
+} // namespace cpp26_static_search
@@ -0,0 +1,737 @@
+#pragma once
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "benchmark.hpp"
+
+namespace cpp26_swiss {
+
+// ============================================================================
+// SWISS TABLE - Open-addressing hash table with SIMD-probed control bytes
+// (after Abseil's flat_hash_map, with Boost/F14-style aligned groups)
+// Every slot has a one-byte control tag: empty, deleted, or the low 7 bits
+// of the key's hash (h2). The remaining bits (h1) pick a starting group of
+// 16 slots (32 with AVX2, 8 in the portable SWAR fallback). A lookup loads
+// the group's tags, compares all of them against h2 in one instruction and
+// checks keys only for the few matches; any empty tag in a group ends the
+// probe. Elements live inline in one array: no per-node allocation and no
+// pointer chase. Erase leaves a tombstone only when the group has never
+// been full, so tables with steady churn stay tombstone-free.
+// Reference: https://abseil.io/about/design/swisstables
+// ============================================================================
+namespace detail {
+
+using ctrl_t = std::int8_t;
+inline constexpr ctrl_t ctrl_empty = -128;   // 0b10000000
+inline constexpr ctrl_t ctrl_deleted = -2;   // 0b11111110
+// Full slots hold h2 in 0..127, so the sign bit alone separates full from free
+
+// Lane indexes set in a match mask; Shift > 0 when each lane spans several bits
+template<int Shift>
+struct bitmask {
+    std::uint64_t bits;
+
+    explicit operator bool() const { return bits != 0; }
+    unsigned lowest() const { return static_cast<unsigned>(std::countr_zero(bits)) >> Shift; }
+    void drop_lowest() { bits &= bits - 1; }
+};
+
+#if defined(__AVX2__)
+struct group {
+    static constexpr std::size_t width = 32;
+    __m256i ctrl;
+
+    explicit group(const ctrl_t* p) : ctrl(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))) {}
+
+    bitmask<0> match(std::uint8_t h2) const {
+        return {static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(static_cast<char>(h2)), ctrl)))};
+    }
+    bitmask<0> match_empty() const {
+        return {static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(ctrl_empty), ctrl)))};
+    }
+    bitmask<0> match_free() const {
+        return {static_cast<std::uint32_t>(_mm256_movemask_epi8(ctrl))};
+    }
+};
+#elif defined(__SSE2__)
+struct group {
+    static constexpr std::size_t width = 16;
+    __m128i ctrl;
+
+    explicit group(const ctrl_t* p) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+    bitmask<0> match(std::uint8_t h2) const {
+        return {static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl)))};
+    }
+    bitmask<0> match_empty() const {
+        return {static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(ctrl_empty), ctrl)))};
+    }
+    bitmask<0> match_free() const {
+        return {static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl))};
+    }
+};
+#else
+// Portable 8-byte groups using SWAR bit tricks on one 64-bit word
+struct group {
+    static constexpr std::size_t width = 8;
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+    static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+    std::uint64_t ctrl;
+
+    explicit group(const ctrl_t* p) { std::memcpy(&ctrl, p, sizeof(ctrl)); }
+
+    // May report a false positive lane next to a true match; keys are compared anyway
+    bitmask<3> match(std::uint8_t h2) const {
+        std::uint64_t x = ctrl ^ (lsbs * h2);
+        return {(x - lsbs) & ~x & msbs};
+    }
+    // Empty is the only tag with the sign bit set and bit 1 clear
+    bitmask<3> match_empty() const { return {ctrl & ~(ctrl << 6) & msbs}; }
+    bitmask<3> match_free() const { return {ctrl & msbs}; }
+};
+#endif
+
+// Hashes that already mix well (cpp26_hash::fast_hash) opt out of the extra
+// mixing step by declaring `using is_avalanching = void;`
+template<typename Hash>
+concept avalanching = requires { typename Hash::is_avalanching; };
+
+template<typename Hash, typename Eq>
+concept transparent = requires {
+    typename Hash::is_transparent;
+    typename Eq::is_transparent;
+};
+
+// Open-addressing core shared by flat_hash_map and flat_hash_set.
+// KeyOf::get(slot) returns the key stored in a slot.
+template<typename Slot, typename Key, typename KeyOf, typename Hash, typename Eq>
+class raw_table {
+private:
+    static constexpr std::size_t width = group::width;
+
+    std::vector<ctrl_t> ctrl;
+    Slot* slots = nullptr;
+    std::size_t cap = 0;          // Power of two, multiple of width (or 0)
+    std::size_t count = 0;
+    std::size_t growth_left = 0;  // Inserts into empty slots before the next rehash
+    [[no_unique_address]] Hash hasher;
+    [[no_unique_address]] Eq equal;
+
+    static std::size_t max_load(std::size_t capacity) { return capacity - capacity / 8; }
+
+    // std::hash is the identity for integers in libstdc++; spread it so h1 and h2 both see every bit
+    template<typename K>
+    std::uint64_t hash_of(const K& key) const {
+        auto h = static_cast<std::uint64_t>(hasher(key));
+        if constexpr (!avalanching<Hash>) {
+            h ^= h >> 32;
+            h *= 0x9E3779B97F4A7C15ull;
+            h ^= h >> 32;
+        }
+        return h;
+    }
+
+    std::size_t group_mask() const { return cap / width - 1; }
+
+    // First free slot along the probe sequence of h
+    std::size_t find_free(std::uint64_t h) const {
+        std::size_t g = (h >> 7) & group_mask();
+        for (std::size_t step = 1;; ++step) {
+            if (auto free = group(ctrl.data() + g * width).match_free()) return g * width + free.lowest();
+            g = (g + step) & group_mask();
+        }
+    }
+
+    void resize(std::size_t new_cap) {
+        std::vector<ctrl_t> old_ctrl(new_cap, ctrl_empty);
+        old_ctrl.swap(ctrl);
+        Slot* old_slots = std::exchange(slots, std::allocator<Slot>().allocate(new_cap));
+        std::size_t old_cap = std::exchange(cap, new_cap);
+
+        for (std::size_t i = 0; i < old_cap; ++i) {
+            if (old_ctrl[i] < 0) continue;
+            std::uint64_t h = hash_of(KeyOf::get(old_slots[i]));
+            std::size_t target = find_free(h);
+            ctrl[target] = static_cast<ctrl_t>(h & 0x7F);
+            std::construct_at(slots + target, std::move(old_slots[i]));
+            std::destroy_at(old_slots + i);
+        }
+        if (old_slots) std::allocator<Slot>().deallocate(old_slots, old_cap);
+        growth_left = max_load(cap) - count;
+    }
+
+    // Tombstone-heavy tables are cleaned in place; full ones double
+    void make_room() {
+        if (cap == 0) resize(width);
+        else if (count <= max_load(cap) / 2) resize(cap);
+        else resize(cap * 2);
+    }
+
+    void destroy_all() {
+        if (!slots) return;
+        for (std::size_t i = 0; i < cap; ++i)
+            if (ctrl[i] >= 0) std::destroy_at(slots + i);
+        std::allocator<Slot>().deallocate(slots, cap);
+        slots = nullptr;
+    }
+
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    raw_table() = default;
+    raw_table(const raw_table& other) : hasher(other.hasher), equal(other.equal) {
+        reserve(other.count);
+        for (std::size_t i = 0; i < other.cap; ++i)
+            if (other.ctrl[i] >= 0) construct(find_or_prepare(KeyOf::get(other.slots[i])).first, other.slots[i]);
+    }
+    raw_table(raw_table&& other) noexcept { swap(other); }
+    raw_table& operator=(raw_table other) noexcept {
+        swap(other);
+        return *this;
+    }
+    ~raw_table() { destroy_all(); }
+
+    void swap(raw_table& other) noexcept {
+        using std::swap;
+        swap(ctrl, other.ctrl);
+        swap(slots, other.slots);
+        swap(cap, other.cap);
+        swap(count, other.count);
+        swap(growth_left, other.growth_left);
+        swap(hasher, other.hasher);
+        swap(equal, other.equal);
+    }
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return cap; }
+    Slot& slot(std::size_t i) { return slots[i]; }
+    const Slot& slot(std::size_t i) const { return slots[i]; }
+
+    // First full slot at or after i (cap if none)
+    std::size_t next_full(std::size_t i) const {
+        while (i < cap && ctrl[i] < 0) ++i;
+        return i;
+    }
+
+    template<typename K>
+    std::size_t find_hashed(const K& key, std::uint64_t h) const {
+        auto h2 = static_cast<std::uint8_t>(h & 0x7F);
+        std::size_t g = (h >> 7) & group_mask();
+        for (std::size_t step = 1;; ++step) {
+            group grp(ctrl.data() + g * width);
+            for (auto m = grp.match(h2); m; m.drop_lowest()) {
+                std::size_t i = g * width + m.lowest();
+                if (equal(KeyOf::get(slots[i]), key)) [[likely]] return i;
+            }
+            if (grp.match_empty()) return npos;
+            g = (g + step) & group_mask();
+        }
+    }
+
+    template<typename K>
+    std::size_t find(const K& key) const {
+        return count == 0 ? npos : find_hashed(key, hash_of(key));
+    }
+
+    // Index of key if present ({i, false}), else a claimed slot for it ({i, true})
+    // that the caller must fill with construct()
+    template<typename K>
+    std::pair<std::size_t, bool> find_or_prepare(const K& key) {
+        std::uint64_t h = hash_of(key);
+        if (count != 0)
+            if (std::size_t i = find_hashed(key, h); i != npos) return {i, false};
+        if (growth_left == 0) make_room();
+        std::size_t i = find_free(h);
+        growth_left -= ctrl[i] == ctrl_empty;
+        ctrl[i] = static_cast<ctrl_t>(h & 0x7F);
+        ++count;
+        return {i, true};
+    }
+
+    template<typename... Args>
+    void construct(std::size_t i, Args&&... args) {
+        try {
+            std::construct_at(slots + i, std::forward<Args>(args)...);
+        } catch (...) {
+            ctrl[i] = ctrl_deleted;  // Give the claimed slot back
+            --count;
+            throw;
+        }
+    }
+
+    void erase_at(std::size_t i) {
+        std::destroy_at(slots + i);
+        --count;
+        // A group that still has an empty slot never overflowed, so no probe
+        // sequence passes through it and the slot can simply become empty
+        if (group(ctrl.data() + (i / width) * width).match_empty()) {
+            ctrl[i] = ctrl_empty;
+            ++growth_left;
+        } else {
+            ctrl[i] = ctrl_deleted;
+        }
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i < cap; ++i)
+            if (ctrl[i] >= 0) std::destroy_at(slots + i);
+        std::fill(ctrl.begin(), ctrl.end(), ctrl_empty);
+        count = 0;
+        growth_left = cap ? max_load(cap) : 0;
+    }
+
+    // Capacity for n elements without rehashing
+    void reserve(std::size_t n) {
+        std::size_t needed = std::bit_ceil(std::max(width, n + n / 7 + 1));
+        if (needed > cap || (needed == cap && growth_left + count < n)) resize(needed);
+    }
+
+    float load_factor() const { return cap ? static_cast<float>(count) / static_cast<float>(cap) : 0.0f; }
+    static constexpr float max_load_factor() { return 0.875f; }
+    static constexpr std::size_t group_width() { return width; }
+
+    // Calls f(key, slot, home group, groups probed) for every element; a
+    // successful lookup of that key visits exactly that many groups.
+    // Returns the slot count.
+    template<typename F>
+    std::size_t for_each_probe(F&& f) const {
+        for (std::size_t i = next_full(0); i < cap; i = next_full(i + 1)) {
+            const auto& key = KeyOf::get(slots[i]);
+            std::size_t home = (hash_of(key) >> 7) & group_mask();
+            std::size_t g = home, groups = 1;
+            for (std::size_t step = 1; g != i / width; ++step, ++groups) g = (g + step) & group_mask();
+            f(key, i, home, groups);
+        }
+        return cap;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// FLAT_HASH_MAP - std::unordered_map-like API over a Swiss table
+// Iterators dereference to std::pair<const Key&, T&> (as in flat_map), and
+// are invalidated by any insert that rehashes.
+// ============================================================================
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map {
+private:
+    using slot_type = std::pair<Key, T>;
+    struct key_of {
+        static const Key& get(const slot_type& s) { return s.first; }
+    };
+    using table_type = detail::raw_table<slot_type, Key, key_of, Hash, KeyEqual>;
+    table_type table;
+
+    template<typename K>
+    static constexpr bool lookup_ok = std::is_same_v<K, Key> || detail::transparent<Hash, KeyEqual>;
+
+public:
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class flat_hash_map;
+        template<bool> friend class basic_iterator;
+        using table_ptr = std::conditional_t<Const, const table_type*, table_type*>;
+        table_ptr owner = nullptr;
+        std::size_t index = 0;
+
+        basic_iterator(table_ptr t, std::size_t i) : owner(t), index(i) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<Key, T>;
+        using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+        struct pointer {
+            reference ref;
+            reference* operator->() { return &ref; }
+        };
+
+        basic_iterator() = default;
+        operator basic_iterator<true>() const { return basic_iterator<true>(owner, index); }
+
+        reference operator*() const {
+            auto& s = owner->slot(index);
+            return {s.first, s.second};
+        }
+        pointer operator->() const { return pointer{**this}; }
+
+        basic_iterator& operator++() {
+            index = owner->next_full(index + 1);
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const basic_iterator& other) const { return index == other.index; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+
+    flat_hash_map() = default;
+    flat_hash_map(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const auto& v : init) insert(v);
+    }
+
+    iterator begin() { return {&table, table.next_full(0)}; }
+    iterator end() { return {&table, table.capacity()}; }
+    const_iterator begin() const { return {&table, table.next_full(0)}; }
+    const_iterator end() const { return {&table, table.capacity()}; }
+
+    std::size_t size() const { return table.size(); }
+    bool empty() const { return table.size() == 0; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto [i, fresh] = table.find_or_prepare(key);
+        if (fresh)
+            table.construct(i, std::piecewise_construct, std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(&table, i), fresh};
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        auto [i, fresh] = table.find_or_prepare(key);
+        if (fresh)
+            table.construct(i, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(&table, i), fresh};
+    }
+
+    template<typename K, typename V>
+    std::pair<iterator, bool> emplace(K&& key, V&& value) {
+        return try_emplace(Key(std::forward<K>(key)), std::forward<V>(value));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& v) { return try_emplace(v.first, v.second); }
+    std::pair<iterator, bool> insert(value_type&& v) { return try_emplace(std::move(v.first), std::move(v.second)); }
+
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) table.slot(result.first.index).second = std::forward<V>(value);
+        return result;
+    }
+
+    T& operator[](const Key& key) { return table.slot(try_emplace(key).first.index).second; }
+    T& operator[](Key&& key) { return table.slot(try_emplace(std::move(key)).first.index).second; }
+
+    template<typename K> requires lookup_ok<K>
+    iterator find(const K& key) {
+        std::size_t i = table.find(key);
+        return i == table_type::npos ? end() : iterator(&table, i);
+    }
+    template<typename K> requires lookup_ok<K>
+    const_iterator find(const K& key) const {
+        std::size_t i = table.find(key);
+        return i == table_type::npos ? end() : const_iterator(&table, i);
+    }
+    iterator find(const Key& key) { return find<Key>(key); }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    bool contains(const K& key) const { return table.find(key) != table_type::npos; }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t count(const K& key) const { return contains(key); }
+    std::size_t count(const Key& key) const { return contains(key); }
+
+    T& at(const Key& key) {
+        std::size_t i = table.find(key);
+        if (i == table_type::npos) throw std::out_of_range("flat_hash_map::at: key not found");
+        return table.slot(i).second;
+    }
+    const T& at(const Key& key) const {
+        std::size_t i = table.find(key);
+        if (i == table_type::npos) throw std::out_of_range("flat_hash_map::at: key not found");
+        return table.slot(i).second;
+    }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t erase(const K& key) {
+        std::size_t i = table.find(key);
+        if (i == table_type::npos) return 0;
+        table.erase_at(i);
+        return 1;
+    }
+    std::size_t erase(const Key& key) { return erase<Key>(key); }
+
+    iterator erase(const_iterator pos) {
+        table.erase_at(pos.index);
+        return {&table, table.next_full(pos.index + 1)};
+    }
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    void clear() { table.clear(); }
+    void reserve(std::size_t n) { table.reserve(n); }
+
+    // Slots, the open-addressing counterpart of std::unordered_map::bucket_count
+    std::size_t bucket_count() const { return table.capacity(); }
+    float load_factor() const { return table.load_factor(); }
+    float max_load_factor() const { return table.max_load_factor(); }
+    static constexpr std::size_t group_width() { return table_type::group_width(); }
+
+    // Probe hooks for cpp26_hash_diagnostics: probes start at one of
+    // home_count() groups
+    std::size_t home_count() const { return table.capacity() / group_width(); }
+    template<typename F>
+    std::size_t for_each_probe(F&& f) const { return table.for_each_probe(f); }
+};
+
+// ============================================================================
+// FLAT_HASH_SET - std::unordered_set-like API over the same table
+// ============================================================================
+template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_set {
+private:
+    struct key_of {
+        static const Key& get(const Key& k) { return k; }
+    };
+    using table_type = detail::raw_table<Key, Key, key_of, Hash, KeyEqual>;
+    table_type table;
+
+    template<typename K>
+    static constexpr bool lookup_ok = std::is_same_v<K, Key> || detail::transparent<Hash, KeyEqual>;
+
+public:
+    class const_iterator {
+    private:
+        friend class flat_hash_set;
+        const table_type* owner = nullptr;
+        std::size_t index = 0;
+
+        const_iterator(const table_type* t, std::size_t i) : owner(t), index(i) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = Key;
+        using reference = const Key&;
+        using pointer = const Key*;
+
+        const_iterator() = default;
+
+        reference operator*() const { return owner->slot(index); }
+        pointer operator->() const { return &owner->slot(index); }
+
+        const_iterator& operator++() {
+            index = owner->next_full(index + 1);
+            return *this;
+        }
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+    };
+
+    using iterator = const_iterator;
+    using key_type = Key;
+    using value_type = Key;
+
+    flat_hash_set() = default;
+    flat_hash_set(std::initializer_list<Key> init) {
+        reserve(init.size());
+        for (const auto& k : init) insert(k);
+    }
+
+    const_iterator begin() const { return {&table, table.next_full(0)}; }
+    const_iterator end() const { return {&table, table.capacity()}; }
+
+    std::size_t size() const { return table.size(); }
+    bool empty() const { return table.size() == 0; }
+
+    std::pair<iterator, bool> insert(const Key& key) {
+        auto [i, fresh] = table.find_or_prepare(key);
+        if (fresh) table.construct(i, key);
+        return {const_iterator(&table, i), fresh};
+    }
+    std::pair<iterator, bool> insert(Key&& key) {
+        auto [i, fresh] = table.find_or_prepare(key);
+        if (fresh) table.construct(i, std::move(key));
+        return {const_iterator(&table, i), fresh};
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return insert(Key(std::forward<Args>(args)...)); }
+
+    template<typename K> requires lookup_ok<K>
+    const_iterator find(const K& key) const {
+        std::size_t i = table.find(key);
+        return i == table_type::npos ? end() : const_iterator(&table, i);
+    }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    bool contains(const K& key) const { return table.find(key) != table_type::npos; }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t count(const K& key) const { return contains(key); }
+    std::size_t count(const Key& key) const { return contains(key); }
+
+    template<typename K> requires lookup_ok<K>
+    std::size_t erase(const K& key) {
+        std::size_t i = table.find(key);
+        if (i == table_type::npos) return 0;
+        table.erase_at(i);
+        return 1;
+    }
+    std::size_t erase(const Key& key) { return erase<Key>(key); }
+
+    iterator erase(const_iterator pos) {
+        table.erase_at(pos.index);
+        return {&table, table.next_full(pos.index + 1)};
+    }
+
+    void clear() { table.clear(); }
+    void reserve(std::size_t n) { table.reserve(n); }
+
+    std::size_t bucket_count() const { return table.capacity(); }
+    float load_factor() const { return table.load_factor(); }
+    float max_load_factor() const { return table.max_load_factor(); }
+
+    std::size_t home_count() const { return table.capacity() / table_type::group_width(); }
+    template<typename F>
+    std::size_t for_each_probe(F&& f) const { return table.for_each_probe(f); }
+};
+
+// Transparent string hash/equality for lookups by string_view or const char*
+struct string_hash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+void demonstrate_swiss_table() {
+    std::cout << "\n=== SWISS TABLE (flat_hash_map) ===\n";
+    std::cout << std::format("Control group width: {} slots\n", flat_hash_map<int, int>::group_width());
+
+    // Same operations as cpp26_unordered::demonstrate_unordered_map
+    flat_hash_map<std::string, int, string_hash, std::equal_to<>> umap = {
+        {"Alice", 25},
+        {"Bob", 30},
+        {"Charlie", 35}
+    };
+
+    umap["David"] = 40;
+    std::cout << std::format("umap[\"Alice\"]: {}\n", umap["Alice"]);
+
+    auto [it1, inserted1] = umap.insert({"Eve", 28});
+    std::cout << std::format("insert Eve: inserted={}\n", inserted1);
+
+    umap.emplace("Frank", 32);
+    umap.try_emplace("Alice", 100);  // Won't overwrite
+
+    std::cout << "All elements:\n";
+    for (const auto& [key, value] : umap) {
+        std::cout << std::format("  {}: {}\n", key, value);
+    }
+
+    auto it = umap.find("Bob");  // const char* lookup, no std::string built
+    if (it != umap.end()) {
+        std::cout << std::format("find(Bob): {}\n", it->second);
+    }
+
+    std::cout << std::format("contains(Charlie): {}\n", umap.contains(std::string_view("Charlie")));
+
+    umap.erase("David");
+    std::cout << std::format("After erase(David): size={}\n", umap.size());
+
+    std::cout << std::format("Slot count: {}\n", umap.bucket_count());
+    std::cout << std::format("Load factor: {:.2f}\n", umap.load_factor());
+    std::cout << std::format("Max load factor: {:.3f}\n", umap.max_load_factor());
+
+    umap.reserve(100);
+    std::cout << std::format("After reserve(100): slots={}\n", umap.bucket_count());
+
+    flat_hash_set<int> uset = {5, 2, 8, 2, 1, 9};
+    uset.erase(2);
+    std::cout << std::format("flat_hash_set: size={}, contains(8)={}, count(2)={}\n",
+                             uset.size(), uset.contains(8), uset.count(2));
+}
+
+// ============================================================================
+// BENCHMARK - std::unordered_map vs flat_hash_map, uint64 -> uint64
+// ============================================================================
+template<typename Map>
+void benchmark_hash_map(const char* label, const std::vector<std::uint64_t>& keys,
+                        const std::vector<std::uint64_t>& misses) {
+    using namespace cpp26_benchmark;
+    const std::size_t n = keys.size();
+    Map map;
+    double insert_ms = time_ms([&] {
+        for (std::size_t i = 0; i < n; ++i) map.emplace(keys[i], i);
+    });
+
+    std::uint64_t sum = 0;
+    double hit_ms = best_of_ms(3, [&] {
+        for (auto k : keys) sum += map.find(k)->second;
+    });
+    double miss_ms = best_of_ms(3, [&] {
+        for (auto k : misses) sum += map.contains(k);
+    });
+    do_not_optimize(sum);
+
+    double erase_ms = time_ms([&] {
+        for (std::size_t i = 0; i < n; i += 2) map.erase(keys[i]);
+    });
+
+    std::cout << std::format("  {:<24} insert {:6.1f}  hit {:6.1f}  miss {:6.1f}  erase {:6.1f}  ns/op\n", label,
+                             insert_ms * 1e6 / n, hit_ms * 1e6 / n, miss_ms * 1e6 / n, erase_ms * 1e6 / (n / 2 + 1));
+}
+
+void demonstrate_swiss_table_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== SWISS TABLE BENCHMARK ===\n";
+
+    for (std::size_t base : {1'000, 100'000, 1'000'000}) {
+        const std::size_t n = scaled(base);
+        SplitMix64 rng(n);
+        std::vector<std::uint64_t> keys(n), misses(n);
+        for (auto& k : keys) k = rng.next();
+        for (auto& k : misses) k = rng.next();
+
+        std::cout << std::format("{} random uint64 keys:\n", n);
+        benchmark_hash_map<std::unordered_map<std::uint64_t, std::uint64_t>>("std::unordered_map", keys, misses);
+        benchmark_hash_map<flat_hash_map<std::uint64_t, std::uint64_t>>("flat_hash_map", keys, misses);
+    }
+}
+
+void run_all_demos() {
+    demonstrate_swiss_table();
+    demonstrate_swiss_table_benchmark();
+}
+
+} // namespace cpp26_swiss
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <bit>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+
+#include "benchmark.hpp"
+
+namespace cpp26_tensor {
+
+// ============================================================================
+// LAYOUTS - Index-to-offset mappings in the style of std::mdspan (C++23)
+// A layout's mapping<Rank> turns a multi-index into a linear offset.
+// layout_right/layout_left work for any rank; the tiled and Morton layouts
+// are 2-D and pad the extents so every tile (or Z-order quadrant) is full.
+// Reference: https://en.cppreference.com/w/cpp/container/mdspan
+// ============================================================================
+template<std::size_t Rank>
+using extents_t = std::array<std::size_t, Rank>;
+
+// Row-major: the last index is contiguous (C arrays, nested std::array)
+struct layout_right {
+    template<std::size_t Rank>
+    struct mapping {
+        extents_t<Rank> extents;
+
+        constexpr std::size_t operator()(const extents_t<Rank>& idx) const {
+            std::size_t offset = 0;
+            for (std::size_t r = 0; r < Rank; ++r) offset = offset * extents[r] + idx[r];
+            return offset;
+        }
+
+        constexpr std::size_t required_span_size() const {
+            return std::accumulate(extents.begin(), extents.end(), std::size_t{1}, std::multiplies<>());
+        }
+    };
+};
+
+// Column-major: the first index is contiguous (Fortran, BLAS)
+struct layout_left {
+    template<std::size_t Rank>
+    struct mapping {
+        extents_t<Rank> extents;
+
+        constexpr std::size_t operator()(const extents_t<Rank>& idx) const {
+            std::size_t offset = 0;
+            for (std::size_t r = Rank; r-- > 0;) offset = offset * extents[r] + idx[r];
+            return offset;
+        }
+
+        constexpr std::size_t required_span_size() const {
+            return std::accumulate(extents.begin(), extents.end(), std::size_t{1}, std::multiplies<>());
+        }
+    };
+};
+
+// Blocked: TileRows x TileCols tiles stored contiguously, row-major inside and between tiles
+template<std::size_t TileRows, std::size_t TileCols>
+struct layout_tiled {
+    template<std::size_t Rank>
+    struct mapping {
+        static_assert(Rank == 2, "layout_tiled is two-dimensional");
+        extents_t<Rank> extents;
+
+        constexpr std::size_t tiles_per_row() const { return (extents[1] + TileCols - 1) / TileCols; }
+
+        constexpr std::size_t operator()(const extents_t<Rank>& idx) const {
+            std::size_t tile = (idx[0] / TileRows) * tiles_per_row() + idx[1] / TileCols;
+            return tile * (TileRows * TileCols) + (idx[0] % TileRows) * TileCols + idx[1] % TileCols;
+        }
+
+        constexpr std::size_t required_span_size() const {
+            return ((extents[0] + TileRows - 1) / TileRows) * tiles_per_row() * TileRows * TileCols;
+        }
+    };
+};
+
+// Morton (Z-order): interleaves row and column bits so nearby 2-D points are nearby in memory
+struct layout_morton {
+    template<std::size_t Rank>
+    struct mapping {
+        static_assert(Rank == 2, "layout_morton is two-dimensional");
+        extents_t<Rank> extents;
+
+        // Spreads the low 32 bits of x into the even bit positions
+        static constexpr std::uint64_t spread_bits(std::uint64_t x) {
+            x &= 0xFFFFFFFFull;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+            x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+            x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+            x = (x | (x << 2)) & 0x3333333333333333ull;
+            x = (x | (x << 1)) & 0x5555555555555555ull;
+            return x;
+        }
+
+        constexpr std::size_t operator()(const extents_t<Rank>& idx) const {
+            return static_cast<std::size_t>((spread_bits(idx[0]) << 1) | spread_bits(idx[1]));
+        }
+
+        constexpr std::size_t required_span_size() const {
+            std::size_t side = std::bit_ceil(std::max(extents[0], extents[1]));
+            return side * side;
+        }
+    };
+};
+
+// ============================================================================
+// MDVIEW - Non-owning N-d view over a pointer (mdspan-style)
+// ============================================================================
+template<typename T, std::size_t Rank, typename Layout = layout_right>
+class mdview {
+private:
+    using mapping_type = typename Layout::template mapping<Rank>;
+
+    T* ptr = nullptr;
+    mapping_type map;
+
+public:
+    mdview() = default;
+    mdview(T* data, const extents_t<Rank>& extents) : ptr(data), map{extents} {}
+
+    template<typename... Indices>
+        requires (sizeof...(Indices) == Rank)
+    T& operator()(Indices... idx) const {
+        return ptr[map(extents_t<Rank>{static_cast<std::size_t>(idx)...})];
+    }
+
+    static constexpr std::size_t rank() { return Rank; }
+    std::size_t extent(std::size_t r) const { return map.extents[r]; }
+    std::size_t size() const {
+        return std::accumulate(map.extents.begin(), map.extents.end(), std::size_t{1}, std::multiplies<>());
+    }
+    std::size_t required_span_size() const { return map.required_span_size(); }
+    std::size_t offset(const extents_t<Rank>& idx) const { return map(idx); }
+    T* data() const { return ptr; }
+};
+
+// ============================================================================
+// TENSOR - Owning N-d array with a chosen layout
+// ============================================================================
+template<typename T, std::size_t Rank, typename Layout = layout_right>
+class tensor {
+private:
+    extents_t<Rank> dims;
+    std::vector<T> storage;
+
+public:
+    explicit tensor(const extents_t<Rank>& extents, const T& value = T{})
+        : dims(extents),
+          storage(typename Layout::template mapping<Rank>{extents}.required_span_size(), value) {}
+
+    template<typename... Indices>
+        requires (sizeof...(Indices) == Rank)
+    T& operator()(Indices... idx) { return view()(idx...); }
+
+    template<typename... Indices>
+        requires (sizeof...(Indices) == Rank)
+    const T& operator()(Indices... idx) const { return view()(idx...); }
+
+    mdview<T, Rank, Layout> view() { return {storage.data(), dims}; }
+    mdview<const T, Rank, Layout> view() const { return {storage.data(), dims}; }
+
+    std::size_t extent(std::size_t r) const { return dims[r]; }
+    std::size_t size() const { return view().size(); }
+    T* data() { return storage.data(); }
+};
+
+// ============================================================================
+// KERNELS - Naive vs cache-blocked transpose and matrix multiply
+// The kernels take views, so they work on any layout; the blocked versions
+// walk BLOCK x BLOCK tiles that fit in L1 so each loaded line is fully used.
+// ============================================================================
+template<typename Src, typename Dst>
+void transpose_naive(const Src& src, const Dst& dst) {
+    for (std::size_t i = 0; i < src.extent(0); ++i)
+        for (std::size_t j = 0; j < src.extent(1); ++j)
+            dst(j, i) = src(i, j);
+}
+
+template<std::size_t Block = 32, typename Src, typename Dst>
+void transpose_blocked(const Src& src, const Dst& dst) {
+    const std::size_t rows = src.extent(0), cols = src.extent(1);
+    for (std::size_t ii = 0; ii < rows; ii += Block)
+        for (std::size_t jj = 0; jj < cols; jj += Block)
+            for (std::size_t i = ii; i < std::min(ii + Block, rows); ++i)
+                for (std::size_t j = jj; j < std::min(jj + Block, cols); ++j)
+                    dst(j, i) = src(i, j);
+}
+
+// C = A * B with the textbook i-j-k order: B is walked down a column
+template<typename A, typename B, typename C>
+void matmul_naive(const A& a, const B& b, const C& c) {
+    for (std::size_t i = 0; i < a.extent(0); ++i)
+        for (std::size_t j = 0; j < b.extent(1); ++j) {
+            auto sum = c(i, j) * 0;
+            for (std::size_t k = 0; k < a.extent(1); ++k) sum += a(i, k) * b(k, j);
+            c(i, j) = sum;
+        }
+}
+
+// C = A * B tiled over i, k and j; the inner i-k-j order makes the
+// innermost loop unit-stride over B and C so it vectorizes
+template<std::size_t Block = 64, typename A, typename B, typename C>
+void matmul_blocked(const A& a, const B& b, const C& c) {
+    const std::size_t n = a.extent(0), m = a.extent(1), p = b.extent(1);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < p; ++j) c(i, j) = 0;
+
+    for (std::size_t ii = 0; ii < n; ii += Block)
+        for (std::size_t kk = 0; kk < m; kk += Block)
+            for (std::size_t jj = 0; jj < p; jj += Block)
+                for (std::size_t i = ii; i < std::min(ii + Block, n); ++i)
+                    for (std::size_t k = kk; k < std::min(kk + Block, m); ++k) {
+                        auto aik = a(i, k);
+                        for (std::size_t j = jj; j < std::min(jj + Block, p); ++j)
+                            c(i, j) += aik * b(k, j);
+                    }
+}
+
+void demonstrate_mdview() {
+    std::cout << "\n=== MDVIEW & TENSOR (mdspan-style) ===\n";
+
+    // The 2x3 matrix from the std::array demo, as a view over flat storage
+    std::vector<int> flat = {1, 2, 3, 4, 5, 6};
+    mdview<int, 2> matrix(flat.data(), {2, 3});
+    std::cout << "2x3 matrix view:\n";
+    for (std::size_t i = 0; i < matrix.extent(0); ++i) {
+        std::cout << "  ";
+        for (std::size_t j = 0; j < matrix.extent(1); ++j) std::cout << matrix(i, j) << " ";
+        std::cout << "\n";
+    }
+
+    // Same storage seen column-major
+    mdview<int, 2, layout_left> col_major(flat.data(), {2, 3});
+    std::cout << std::format("Same data as layout_left: (0,1)={}, (1,0)={}\n", col_major(0, 1), col_major(1, 0));
+
+    // A 2x2x2 cube with runtime extents
+    tensor<int, 3> cube({2, 2, 2});
+    int value = 0;
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            for (std::size_t k = 0; k < 2; ++k) cube(i, j, k) = value++;
+    std::cout << std::format("cube(1,0,1)={}, rank={}, size={}\n", cube(1, 0, 1), cube.view().rank(), cube.size());
+
+    // Offsets of a 4x4 grid under each layout
+    auto print_offsets = [](const char* name, const auto& view) {
+        std::cout << std::format("{} (span {}):\n", name, view.required_span_size());
+        for (std::size_t i = 0; i < 4; ++i) {
+            std::cout << "  ";
+            for (std::size_t j = 0; j < 4; ++j) std::cout << std::format("{:3}", view.offset({i, j}));
+            std::cout << "\n";
+        }
+    };
+    print_offsets("layout_right", mdview<float, 2, layout_right>(nullptr, {4, 4}));
+    print_offsets("layout_left", mdview<float, 2, layout_left>(nullptr, {4, 4}));
+    print_offsets("layout_tiled<2,2>", mdview<float, 2, layout_tiled<2, 2>>(nullptr, {4, 4}));
+    print_offsets("layout_morton", mdview<float, 2, layout_morton>(nullptr, {4, 4}));
+
+    // Kernels are layout-generic: multiply in a tiled layout and check against row-major
+    const std::size_t n = 48;
+    tensor<double, 2> a({n, n}), b({n, n}), c_naive({n, n}), c_blocked({n, n});
+    tensor<double, 2, layout_tiled<8, 8>> at({n, n}), bt({n, n}), ct({n, n});
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j) {
+            a(i, j) = at(i, j) = std::sin(static_cast<double>(i * n + j));
+            b(i, j) = bt(i, j) = std::cos(static_cast<double>(i + j));
+        }
+    matmul_naive(a.view(), b.view(), c_naive.view());
+    matmul_blocked<16>(a.view(), b.view(), c_blocked.view());
+    matmul_blocked<8>(at.view(), bt.view(), ct.view());
+
+    double err_blocked = 0, err_tiled = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j) {
+            err_blocked = std::max(err_blocked, std::abs(c_naive(i, j) - c_blocked(i, j)));
+            err_tiled = std::max(err_tiled, std::abs(c_naive(i, j) - ct(i, j)));
+        }
+    std::cout << std::format("{}x{} matmul max error: blocked={:.2e}, tiled layout={:.2e}\n",
+                             n, n, err_blocked, err_tiled);
+}
+
+// ============================================================================
+// KERNEL BENCHMARK - Naive loops vs cache-blocked kernels
+// Transposes use fixed 1K-4K sides, already far past the caches. Matmul work
+// grows with the cube of the side, so the side follows the cube root of
+// CPP26_BENCH_SCALE: 256-1K by default, 2K-8K at a scale of 512.
+// ============================================================================
+void demonstrate_tensor_benchmark() {
+    using namespace cpp26_benchmark;
+    std::cout << "\n=== TENSOR KERNEL BENCHMARK ===\n";
+
+    for (std::size_t n : {1024, 2048, 4096}) {
+        tensor<float, 2> src({n, n}), dst({n, n});
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j) src(i, j) = static_cast<float>(i ^ j);
+
+        std::cout << std::format("transpose {}x{}:\n", n, n);
+        print_result("naive", time_ms([&] { transpose_naive(src.view(), dst.view()); }), n * n);
+        print_result("blocked 32x32", time_ms([&] { transpose_blocked<32>(src.view(), dst.view()); }), n * n);
+        do_not_optimize(dst(1, 0));
+    }
+
+    // Rounded to a multiple of 64 so the blocked kernel tiles it exactly
+    const double growth = std::cbrt(static_cast<double>(scale));
+    for (std::size_t base : {256, 512, 1024}) {
+        const std::size_t n = static_cast<std::size_t>(std::lround(static_cast<double>(base) * growth / 64)) * 64;
+        tensor<float, 2> a({n, n}), b({n, n}), c({n, n});
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j) {
+                a(i, j) = static_cast<float>((i + j) % 7);
+                b(i, j) = static_cast<float>((i * j) % 5);
+            }
+
+        std::cout << std::format("matmul {}x{} (ns per multiply-add):\n", n, n);
+        print_result("naive i-j-k", time_ms([&] { matmul_naive(a.view(), b.view(), c.view()); }), n * n * n);
+        print_result("blocked 64 i-k-j", time_ms([&] { matmul_blocked<64>(a.view(), b.view(), c.view()); }), n * n * n);
+        do_not_optimize(c(0, 0));
+    }
+}
+
+void run_all_demos() {
+    demonstrate_mdview();
+    demonstrate_tensor_benchmark();
+}
+
+} // namespace cpp26_tensor
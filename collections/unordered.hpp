@@ -5,6 +5,9 @@
 #include <unordered_set>
 #include <string>
 #include <format>
+#include <memory_resource>
+#include <array>
+#include <cstddef>
 
 namespace cpp26_unordered {
 
@@ -109,9 +112,31 @@ void demonstrate_unordered_set() {
     std::cout << std::format("size={}, bucket_count={}\n", uset.size(), uset.bucket_count());
 }
 
+// ============================================================================
+// PMR UNORDERED_MAP - Hash map with a monotonic resource (C++17)
+// ============================================================================
+void demonstrate_unordered_pmr() {
+    std::cout << "\n=== PMR UNORDERED_MAP ===\n";
+
+    std::array<std::byte, 8192> buffer;
+    std::pmr::monotonic_buffer_resource pool(buffer.data(), buffer.size());
+
+    // Every rehash allocates a new bucket array and a monotonic resource never
+    // reclaims the old one, so reserve() the final size up front
+    std::pmr::unordered_map<int, int> squares(&pool);
+    squares.reserve(50);
+    for (int i = 0; i < 50; ++i) squares.emplace(i, i * i);
+
+    std::cout << std::format("size={}, bucket_count={}, squares[7]={}\n",
+                             squares.size(), squares.bucket_count(), squares.at(7));
+    std::cout << std::format("Resource is pool: {}\n",
+                             squares.get_allocator().resource() == &pool);
+}
+
 void run_all_demos() {
     demonstrate_unordered_map();
     demonstrate_unordered_set();
+    demonstrate_unordered_pmr();
 }
 
 } // namespace cpp26_unordered
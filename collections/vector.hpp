@@ -4,6 +4,9 @@
 #include <vector>
 #include <algorithm>
 #include <numeric>
+#include <memory_resource>
+#include <array>
+#include <cstddef>
 #include <format>
 
 namespace cpp26_vector {
@@ -351,6 +354,32 @@ void demonstrate_vector_bool() {
     std::cout << "Size in bytes (approximate): " << (bools.size() / 8) << "\n";
 }
 
+// Demonstrates std::pmr::vector backed by a stack buffer (C++17)
+void demonstrate_vector_pmr() {
+    std::cout << "\n=== PMR VECTOR (Polymorphic Allocator) ===\n";
+
+    // All storage comes from this buffer; null_memory_resource() makes any
+    // attempt to fall back to the heap throw std::bad_alloc instead
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource pool(buffer.data(), buffer.size(),
+                                             std::pmr::null_memory_resource());
+
+    std::pmr::vector<int> vec(&pool);
+    vec.reserve(64);  // Monotonic resources never reuse freed memory, so reserve once
+    for (int i = 0; i < 64; ++i) vec.push_back(i * i);
+
+    std::cout << std::format("size={}, capacity={}, last={}\n", vec.size(), vec.capacity(), vec.back());
+    std::cout << std::format("data() inside stack buffer: {}\n",
+                             static_cast<void*>(vec.data()) >= static_cast<void*>(buffer.data()) &&
+                             static_cast<void*>(vec.data()) < static_cast<void*>(buffer.data() + buffer.size()));
+
+    try {
+        vec.reserve(10'000);  // Larger than the buffer
+    } catch (const std::bad_alloc&) {
+        std::cout << "reserve(10000) beyond the buffer: std::bad_alloc\n";
+    }
+}
+
 // Main runner for all vector demonstrations
 void run_all_demos() {
     demonstrate_vector_construction();
@@ -362,6 +391,7 @@ void run_all_demos() {
     demonstrate_vector_algorithms();
     demonstrate_vector_custom_objects();
     demonstrate_vector_bool();
+    demonstrate_vector_pmr();
 }
 
 } // namespace cpp26_vector
@@ -25,6 +25,31 @@
 #include "collections/adapters.hpp"
 #include "collections/algorithms.hpp"
 #include "collections/ranges.hpp"
+#include "collections/pmr.hpp"
+#include "collections/soa.hpp"
+#include "collections/bitvector.hpp"
+#include "collections/hive.hpp"
+#include "collections/tensor.hpp"
+#include "collections/lookup_table.hpp"
+#include "collections/intrusive_list.hpp"
+#include "collections/segmented_deque.hpp"
+#include "collections/flat_map.hpp"
+#include "collections/btree.hpp"
+#include "collections/skiplist.hpp"
+#include "collections/art.hpp"
+#include "collections/interval_index.hpp"
+#include "collections/static_search.hpp"
+#include "collections/roaring.hpp"
+#include "collections/set_kernels.hpp"
+#include "collections/swiss_table.hpp"
+#include "collections/hashing.hpp"
+#include "collections/concurrent_hash_map.hpp"
+#include "collections/filters.hpp"
+#include "collections/perfect_hash.hpp"
+#include "collections/hash_diagnostics.hpp"
+#include "collections/dary_heap.hpp"
+#include "collections/multiqueue.hpp"
+#include "collections/radix_heap.hpp"
 
 // ============================================================================
 // Menu system for interactive demonstration
@@ -41,6 +66,31 @@ void display_collections_menu() {
     std::cout << "  8. STL Algorithms\n";
     std::cout << "  9. Ranges (C++20)\n";
     std::cout << "  A. Run All Collections\n";
+    std::cout << "  B. PMR Allocators & Arenas (Benchmark)\n";
+    std::cout << "  C. Structure-of-Arrays Vector (Benchmark)\n";
+    std::cout << "  D. Bitvector with Rank/Select (Benchmark)\n";
+    std::cout << "  E. Hive / Colony Container (Benchmark)\n";
+    std::cout << "  F. mdspan-Style Tensor & Blocked Kernels (Benchmark)\n";
+    std::cout << "  G. Constexpr Lookup Tables (Benchmark)\n";
+    std::cout << "  H. Intrusive List & Object Pool (Benchmark)\n";
+    std::cout << "  I. Segmented Deque with Bulk Ops (Benchmark)\n";
+    std::cout << "  J. Flat Map / Flat Set (Benchmark)\n";
+    std::cout << "  K. B+-Tree Ordered Map (Benchmark)\n";
+    std::cout << "  L. Lock-Free Skip List Map (Benchmark)\n";
+    std::cout << "  M. Adaptive Radix Tree (Benchmark)\n";
+    std::cout << "  N. Interval Index (Benchmark)\n";
+    std::cout << "  O. Eytzinger / Static B-Tree Search (Benchmark)\n";
+    std::cout << "  P. Roaring Bitmap (Benchmark)\n";
+    std::cout << "  Q. SIMD Sorted-Set Kernels (Benchmark)\n";
+    std::cout << "  R. Swiss Table Hash Map (Benchmark)\n";
+    std::cout << "  S. Fast Hash Functions (Benchmark)\n";
+    std::cout << "  T. Concurrent Hash Map (Benchmark)\n";
+    std::cout << "  U. Bloom / Cuckoo / Binary Fuse Filters (Benchmark)\n";
+    std::cout << "  V. Compile-Time Perfect Hashing (Benchmark)\n";
+    std::cout << "  W. Hash Table Diagnostics\n";
+    std::cout << "  X. Indexed D-ary Heap (Benchmark)\n";
+    std::cout << "  Y. MultiQueue Relaxed Priority Queue (Benchmark)\n";
+    std::cout << "  Z. Radix Heap / Bucket Queue (Benchmark)\n";
     std::cout << "  0. Back to Main Menu\n";
     std::cout << "\nEnter choice: ";
 }
@@ -216,6 +266,131 @@ int main() {
                             time_execution("Ranges", cpp26_ranges::run_all_demos);
                             wait_for_enter();
                             break;
+                        case 'B': case 'b':
+                            std::cout << "\n=== PMR ALLOCATORS ===\n";
+                            time_execution("PMR", cpp26_pmr::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'C': case 'c':
+                            std::cout << "\n=== SOA VECTOR ===\n";
+                            time_execution("SoA", cpp26_soa::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'D': case 'd':
+                            std::cout << "\n=== BITVECTOR ===\n";
+                            time_execution("Bitvector", cpp26_bitvector::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'E': case 'e':
+                            std::cout << "\n=== HIVE ===\n";
+                            time_execution("Hive", cpp26_hive::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'F': case 'f':
+                            std::cout << "\n=== TENSOR ===\n";
+                            time_execution("Tensor", cpp26_tensor::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'G': case 'g':
+                            std::cout << "\n=== LOOKUP TABLES ===\n";
+                            time_execution("Lookup Tables", cpp26_lookup_table::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'H': case 'h':
+                            std::cout << "\n=== INTRUSIVE LIST ===\n";
+                            time_execution("Intrusive List", cpp26_intrusive::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'I': case 'i':
+                            std::cout << "\n=== SEGMENTED DEQUE ===\n";
+                            time_execution("Segmented Deque", cpp26_segmented_deque::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'J': case 'j':
+                            std::cout << "\n=== FLAT MAP ===\n";
+                            time_execution("Flat Map", cpp26_flat::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'K': case 'k':
+                            std::cout << "\n=== B+-TREE ===\n";
+                            time_execution("B+-Tree", cpp26_btree::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'L': case 'l':
+                            std::cout << "\n=== SKIP LIST ===\n";
+                            time_execution("Skip List", cpp26_skiplist::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'M': case 'm':
+                            std::cout << "\n=== ADAPTIVE RADIX TREE ===\n";
+                            time_execution("Adaptive Radix Tree", cpp26_art::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'N': case 'n':
+                            std::cout << "\n=== INTERVAL INDEX ===\n";
+                            time_execution("Interval Index", cpp26_interval::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'O': case 'o':
+                            std::cout << "\n=== STATIC SEARCH LAYOUTS ===\n";
+                            time_execution("Static Search", cpp26_static_search::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'P': case 'p':
+                            std::cout << "\n=== ROARING BITMAP ===\n";
+                            time_execution("Roaring Bitmap", cpp26_roaring::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'Q': case 'q':
+                            std::cout << "\n=== SORTED-SET KERNELS ===\n";
+                            time_execution("Set Kernels", cpp26_set_kernels::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'R': case 'r':
+                            std::cout << "\n=== SWISS TABLE ===\n";
+                            time_execution("Swiss Table", cpp26_swiss::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'S': case 's':
+                            std::cout << "\n=== FAST HASHING ===\n";
+                            time_execution("Fast Hashing", cpp26_hash::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'T': case 't':
+                            std::cout << "\n=== CONCURRENT HASH MAP ===\n";
+                            time_execution("Concurrent Hash Map", cpp26_concurrent_hash::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'U': case 'u':
+                            std::cout << "\n=== MEMBERSHIP FILTERS ===\n";
+                            time_execution("Filters", cpp26_filters::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'V': case 'v':
+                            std::cout << "\n=== PERFECT HASHING ===\n";
+                            time_execution("Perfect Hashing", cpp26_perfect_hash::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'W': case 'w':
+                            std::cout << "\n=== HASH TABLE DIAGNOSTICS ===\n";
+                            time_execution("Hash Table Diagnostics", cpp26_hash_diagnostics::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'X': case 'x':
+                            std::cout << "\n=== INDEXED D-ARY HEAP ===\n";
+                            time_execution("Indexed D-ary Heap", cpp26_dary_heap::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'Y': case 'y':
+                            std::cout << "\n=== MULTIQUEUE ===\n";
+                            time_execution("MultiQueue", cpp26_multiqueue::run_all_demos);
+                            wait_for_enter();
+                            break;
+                        case 'Z': case 'z':
+                            std::cout << "\n=== RADIX HEAP / BUCKET QUEUE ===\n";
+                            time_execution("Radix Heap", cpp26_radix_heap::run_all_demos);
+                            wait_for_enter();
+                            break;
                         case 'A': case 'a':
                             std::cout << "\n=== ALL COLLECTIONS ===\n";
                             time_execution("All Collections", []() {
@@ -228,6 +403,31 @@ int main() {
                                 cpp26_adapters::run_all_demos();
                                 cpp26_algorithms::run_all_demos();
                                 cpp26_ranges::run_all_demos();
+                                cpp26_pmr::run_all_demos();
+                                cpp26_soa::run_all_demos();
+                                cpp26_bitvector::run_all_demos();
+                                cpp26_hive::run_all_demos();
+                                cpp26_tensor::run_all_demos();
+                                cpp26_lookup_table::run_all_demos();
+                                cpp26_intrusive::run_all_demos();
+                                cpp26_segmented_deque::run_all_demos();
+                                cpp26_flat::run_all_demos();
+                                cpp26_btree::run_all_demos();
+                                cpp26_skiplist::run_all_demos();
+                                cpp26_art::run_all_demos();
+                                cpp26_interval::run_all_demos();
+                                cpp26_static_search::run_all_demos();
+                                cpp26_roaring::run_all_demos();
+                                cpp26_set_kernels::run_all_demos();
+                                cpp26_swiss::run_all_demos();
+                                cpp26_hash::run_all_demos();
+                                cpp26_concurrent_hash::run_all_demos();
+                                cpp26_filters::run_all_demos();
+                                cpp26_perfect_hash::run_all_demos();
+                                cpp26_hash_diagnostics::run_all_demos();
+                                cpp26_dary_heap::run_all_demos();
+                                cpp26_multiqueue::run_all_demos();
+                                cpp26_radix_heap::run_all_demos();
                             });
                             wait_for_enter();
                             break;
@@ -337,6 +537,31 @@ int main() {
                     cpp26_adapters::run_all_demos();
                     cpp26_algorithms::run_all_demos();
                     cpp26_ranges::run_all_demos();
+                    cpp26_pmr::run_all_demos();
+                    cpp26_soa::run_all_demos();
+                    cpp26_bitvector::run_all_demos();
+                    cpp26_hive::run_all_demos();
+                    cpp26_tensor::run_all_demos();
+                    cpp26_lookup_table::run_all_demos();
+                    cpp26_intrusive::run_all_demos();
+                    cpp26_segmented_deque::run_all_demos();
+                    cpp26_flat::run_all_demos();
+                    cpp26_btree::run_all_demos();
+                    cpp26_skiplist::run_all_demos();
+                    cpp26_art::run_all_demos();
+                    cpp26_interval::run_all_demos();
+                    cpp26_static_search::run_all_demos();
+                    cpp26_roaring::run_all_demos();
+                    cpp26_set_kernels::run_all_demos();
+                    cpp26_swiss::run_all_demos();
+                    cpp26_hash::run_all_demos();
+                    cpp26_concurrent_hash::run_all_demos();
+                    cpp26_filters::run_all_demos();
+                    cpp26_perfect_hash::run_all_demos();
+                    cpp26_hash_diagnostics::run_all_demos();
+                    cpp26_dary_heap::run_all_demos();
+                    cpp26_multiqueue::run_all_demos();
+                    cpp26_radix_heap::run_all_demos();
 
                     std::cout << "\n\n### THREADING ###\n";
                     cpp26_threading::run_all_demos();
@@ -436,6 +661,31 @@ int main() {
  *   - Iterators (back_inserter, front_inserter)
  *   - Ranges (C++20 views: filter, transform, take, drop, reverse)
  *   - Range algorithms (all_of, any_of, none_of, count_if)
+ *   - Polymorphic allocators (std::pmr containers, bump arena, per-request arenas)
+ *   - Structure-of-arrays container (soa_vector, row proxies, sort by field)
+ *   - Rank/select bitvector (bulk AND/OR/XOR/NOT, AVX2 popcount, tzcnt iteration)
+ *   - Hive container (chunked storage, skip field, stable iterators, O(1) erase)
+ *   - mdview/tensor with row/col-major, tiled and Morton layouts, blocked kernels
+ *   - constexpr std::array tables (CRC, sin/exp, popcount, byte classes) with interpolation
+ *   - Intrusive lists (hooks in the element, multi-list membership, pooled nodes)
+ *   - Segmented deque (compile-time block size, span segments, bulk append/pop)
+ *   - flat_map/flat_set (bulk build, merge insert, transparent lookup, branchless search)
+ *   - B+-tree map (cache-line nodes, SIMD node search, linked leaves, bulk load)
+ *   - Lock-free skip-list map with epoch-based reclamation
+ *   - Adaptive radix tree: Node4/16/48/256, path compression, prefix scans
+ *   - Interval index: implicit sorted-array interval tree, treap variant, sorted-batch stabbing
+ *   - Eytzinger and static B-tree search layouts with prefetch and batched queries
+ *   - Roaring bitmap: array/bitmap/run containers, set ops, portable serialization
+ *   - Sorted-set intersection/union kernels: AVX2 block compare, galloping, count-only
+ *   - Swiss-table flat_hash_map/flat_hash_set with SIMD-probed control groups
+ *   - wyhash/xxhash64 byte hashes, integer mixers, fast_hash combinator, quality report
+ *   - sharded concurrent_hash_map with seqlock reads and per-shard resize
+ *   - Bloom, blocked Bloom, cuckoo and binary fuse membership filters
+ *   - consteval perfect hash tables for static string/integer key sets
+ *   - Hash diagnostics: bucket/probe histograms, skew, hash collision rates, rehash traces
+ *   - indexed_dary_heap with decrease_key/erase by handle vs lazy-deletion priority_queue
+ *   - multiqueue: relaxed concurrent priority queue, rank error vs throughput
+ *   - radix_heap and bucket_queue for monotone integer keys vs priority_queue
  *
  * THREADING:
  *   - Basic threads (std::thread)